@@ -13,6 +13,11 @@ FmodAudioListener::FmodAudioListener(const SpawnParams& params)
 
 }
 
+void FmodAudioListener::SetWeight(float value)
+{
+    _weight = Math::Saturate(value);
+}
+
 void FmodAudioListener::OnEnable()
 {
     Actor::OnEnable();
@@ -50,10 +55,9 @@ void FmodAudioListener::OnDisable()
     // Code executed only during play mode.
     if (Engine::IsPlayMode())
     {
-        if (FmodAudio::ActiveListener == this)
-            FmodAudio::ActiveListener = nullptr;
-        
         FmodAudio::Listeners.Remove(this);
+        if (FmodAudio::ActiveListener == this)
+            FmodAudio::ActiveListener = FmodAudio::Listeners.HasItems() ? FmodAudio::Listeners.Last() : nullptr;
         GetScene()->Ticking.Update.RemoveTick(this);
     }
 
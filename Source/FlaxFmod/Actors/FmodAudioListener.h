@@ -18,9 +18,25 @@ public:
         return _velocity;
     }
 
+    /// <summary>
+    /// The weight of the listener in the mix when multiple listeners are enabled. 0 excludes the listener, 1 is full weight.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorDisplay(\"Fmod Audio Listener\"), Limit(0, 1, 0.01f), EditorOrder(0)")
+    FORCE_INLINE float GetWeight() const
+    {
+        return _weight;
+    }
+
+    /// <summary>
+    /// The weight of the listener in the mix when multiple listeners are enabled. 0 excludes the listener, 1 is full weight.
+    /// </summary>
+    API_PROPERTY()
+    void SetWeight(float value);
+
 private:
     Vector3 _previousPosition;
     Vector3 _velocity;
+    float _weight = 1.0f;
 
     // [Actor]
     void OnEnable() override;
@@ -115,28 +115,57 @@ bool FmodAudioSource::CheckForEvent()
     return true;
 }
 
+void FmodAudioSource::MarkAttributesDirty()
+{
+    // Only enabled sources are synced by the audio system.
+    if (_attributesDirty || !IsActiveInHierarchy())
+        return;
+    _attributesDirty = true;
+    FmodAudio::DirtySources.Add(this);
+}
+
 void FmodAudioSource::Play()
 {
     if (!CheckForEvent())
         return;
 
+    // One-shots played out of range would be inaudible, other events start once back in range.
+    if (_virtual)
+    {
+        _playPending = !_virtualOneshot;
+        return;
+    }
+
+    // Event instance is waiting for its bank to finish loading.
+    if (!EventInstance)
+    {
+        _playPending = true;
+        return;
+    }
+
     if (FmodAudio::GetAudioSystem()->IsEventPaused(EventInstance))
         FmodAudio::GetAudioSystem()->PauseEvent(EventInstance, false);
     if (!IsPlaying())
     {
         auto system = FmodAudio::GetAudioSystem();
+        const auto fmodEvent = Event.GetInstance();
+        if (!system->CheckEventLimits(fmodEvent))
+            return;
         system->RegisterEventCallback(EventInstance, _enableMarkerEvents, _enableBeatEvents);
         float length = system->GetEventLength(EventInstance);
         if (_startTime < length)
             system->SetEventPosition(EventInstance, _startTime);
 
+        system->ApplyEventLimits(fmodEvent);
         system->PlayEvent(EventInstance);
+        system->AddLimitedEventInstance(fmodEvent, EventInstance);
     }
 }
 
 void FmodAudioSource::Stop()
 {
-    if (!CheckForEvent())
+    _playPending = false;
+    if (!CheckForEvent() || !EventInstance)
         return;
 
     FmodAudio::GetAudioSystem()->StopEvent(EventInstance, !_allowFadeout);
@@ -155,6 +184,9 @@ bool FmodAudioSource::IsPlaying()
     if (!CheckForEvent())
         return false;
 
+    if (_virtual)
+        return _playPending;
+
     bool isPaused = FmodAudio::GetAudioSystem()->IsEventPaused(EventInstance);
     if (isPaused)
         return false;
@@ -171,23 +203,114 @@ bool FmodAudioSource::Is3D()
     return false;
 }
 
+void FmodAudioSource::SetPendingParameter(const String& parameterName, const FmodParameterId& parameterId, float value)
+{
+    for (auto& parameter : _pendingParameters)
+    {
+        if ((parameterId.IsValid() && parameter.Id.Data1 == parameterId.Data1 && parameter.Id.Data2 == parameterId.Data2) || (parameterName.HasChars() && parameter.Name == parameterName))
+        {
+            parameter.Value = value;
+            return;
+        }
+    }
+    auto& parameter = _pendingParameters.AddOne();
+    parameter.Name = parameterName;
+    parameter.Id = parameterId;
+    parameter.Value = value;
+}
+
+const FmodParameter* FmodAudioSource::FindPendingParameter(const String& parameterName, const FmodParameterId& parameterId) const
+{
+    for (const auto& parameter : _pendingParameters)
+    {
+        if ((parameterId.IsValid() && parameter.Id.Data1 == parameterId.Data1 && parameter.Id.Data2 == parameterId.Data2) || (parameterName.HasChars() && parameter.Name == parameterName))
+            return &parameter;
+    }
+    return nullptr;
+}
+
 void FmodAudioSource::SetParameter(const String& parameterName, float value)
 {
-    if (!CheckForEvent())
+    if (!CheckForEvent() || !Engine::IsPlayMode())
         return;
 
-    if (EventInstance && Engine::IsPlayMode())
+    // Virtual and deferred sources apply the parameters once their instance is created.
+    if (EventInstance)
         FmodAudio::GetAudioSystem()->SetEventParameter(EventInstance, parameterName, value);
+    else
+        SetPendingParameter(parameterName, FmodParameterId(), value);
 }
 
 float FmodAudioSource::GetParameter(const String& parameterName)
 {
-    if (!CheckForEvent())
+    if (!CheckForEvent() || !Engine::IsPlayMode())
         return -1.0f;
 
-    if (EventInstance && Engine::IsPlayMode())
+    if (EventInstance)
         return FmodAudio::GetAudioSystem()->GetEventParameter(EventInstance, parameterName);
-    return -1.0f;
+    const auto parameter = FindPendingParameter(parameterName, FmodParameterId());
+    return parameter ? parameter->Value : -1.0f;
+}
+
+FmodParameterId FmodAudioSource::GetParameterId(const String& parameterName)
+{
+    if (!CheckForEvent() || !Engine::IsPlayMode())
+        return FmodParameterId();
+
+    auto system = FmodAudio::GetAudioSystem();
+    if (EventInstance)
+        return system->GetEventParameterId(EventInstance, parameterName);
+
+    // Virtual and deferred sources resolve the id from the event description.
+    const auto fmodEvent = Event.GetInstance();
+    if (!fmodEvent)
+        return FmodParameterId();
+    const auto metadata = fmodEvent->Guid.HasChars() ? system->GetEventMetadata(fmodEvent->GetFmodGuid()) : system->GetEventMetadata(fmodEvent->Path);
+    return system->GetEventParameterId(metadata, parameterName);
+}
+
+void FmodAudioSource::SetParameter(const FmodParameterId& parameterId, float value)
+{
+    if (!CheckForEvent() || !Engine::IsPlayMode() || !parameterId.IsValid())
+        return;
+
+    if (EventInstance)
+        FmodAudio::GetAudioSystem()->SetEventParameter(EventInstance, parameterId, value);
+    else
+        SetPendingParameter(String::Empty, parameterId, value);
+}
+
+float FmodAudioSource::GetParameter(const FmodParameterId& parameterId)
+{
+    if (!CheckForEvent() || !Engine::IsPlayMode())
+        return -1.0f;
+
+    if (EventInstance)
+        return FmodAudio::GetAudioSystem()->GetEventParameter(EventInstance, parameterId);
+    const auto parameter = FindPendingParameter(String::Empty, parameterId);
+    return parameter ? parameter->Value : -1.0f;
+}
+
+void FmodAudioSource::SetParameters(const Span<FmodParameterId>& parameterIds, const Span<float>& values)
+{
+    if (!CheckForEvent())
+        return;
+
+    if (parameterIds.Length() != values.Length())
+        FMODLOG(Warning, "FmodAudioSource {} parameter ids count ({}) does not match values count ({}).", GetName(), parameterIds.Length(), values.Length());
+    if (!Engine::IsPlayMode())
+        return;
+    const int32 count = Math::Min(parameterIds.Length(), values.Length());
+    if (EventInstance)
+    {
+        FmodAudio::GetAudioSystem()->SetEventParameters(EventInstance, parameterIds.Get(), values.Get(), count);
+        return;
+    }
+    for (int32 i = 0; i < count; i++)
+    {
+        if (parameterIds[i].IsValid())
+            SetPendingParameter(String::Empty, parameterIds[i], values[i]);
+    }
 }
 
 void FmodAudioSource::OnEnable()
@@ -202,7 +325,9 @@ void FmodAudioSource::OnEnable()
         return;
 
     FmodAudio::Sources.AddUnique(this);
+    FmodAudio::SourceGrid.Add(this);
     GetScene()->Ticking.Update.AddTick<FmodAudioSource, &FmodAudioSource::Update>(this);
+    MarkAttributesDirty();
 }
 
 void FmodAudioSource::Update()
@@ -213,6 +338,10 @@ void FmodAudioSource::Update()
     const auto prevVelocity = _velocity;
     _velocity = (pos - _previousPosition) / dt;
     _previousPosition = pos;
+
+    // Velocity settling back to zero does not fire a transform change.
+    if (_velocity != prevVelocity)
+        MarkAttributesDirty();
 }
 
 void FmodAudioSource::OnDisable()
@@ -225,6 +354,12 @@ void FmodAudioSource::OnDisable()
     if (Engine::IsPlayMode())
     {
         FmodAudio::Sources.Remove(this);
+        FmodAudio::SourceGrid.Remove(this);
+        if (_attributesDirty)
+        {
+            FmodAudio::DirtySources.Remove(this);
+            _attributesDirty = false;
+        }
         GetScene()->Ticking.Update.RemoveTick(this);
         Stop();
     }
@@ -253,9 +388,16 @@ void FmodAudioSource::OnEndPlay()
 {
     if (Engine::IsPlayMode())
     {
-        if (EventInstance)
-            FmodAudio::GetAudioSystem()->ReleaseEventInstance(EventInstance);
-        EventInstance = nullptr;
+        if (auto system = FmodAudio::GetAudioSystem())
+        {
+            system->CancelDeferredEventInstance(this);
+            if (EventInstance)
+                system->ReleaseEventInstance(EventInstance);
+        }
+        EventInstance = FmodEventHandle();
+        _playPending = false;
+        _virtual = false;
+        _pendingParameters.Clear();
     }
     Actor::OnEndPlay();
 }
@@ -280,22 +422,60 @@ void FmodAudioSource::OnEventLoaded()
         if (Event)
         {
             auto system = FmodAudio::GetAudioSystem();
-            EventInstance = system->CreateEventInstance(Event.GetInstance()->Path, this);
-            system->SetEventVolumeMultiplier(EventInstance, _volumeMultiplier);
-            system->SetEventPitchMultiplier(EventInstance, _pitchMultiplier);
-            system->SetEventMaxDistance(EventInstance, _overrideDistance ? _maxDistance : -1.0f);
-            system->SetEventMinDistance(EventInstance, _overrideDistance ? _minDistance : -1.0f);
-
-            // Set initial parameters
-            for (int i = 0; i < InitialParameters.Count(); i++)
-            {
-                auto parameter = InitialParameters[i];
-                SetParameter(parameter.Name, parameter.Value);
-            }
+            if (system->DeferEventInstance(this) || system->VirtualizeEventInstance(this))
+                return;
+            CreateInstance();
         }
     }
 }
 
+void FmodAudioSource::CreateInstance()
+{
+    auto system = FmodAudio::GetAudioSystem();
+    const auto fmodEvent = Event.GetInstance();
+    system->WarmEventInstances(fmodEvent);
+    if (fmodEvent->Guid.HasChars())
+        EventInstance = system->CreateEventInstance(fmodEvent->GetFmodGuid(), this);
+    else
+        EventInstance = system->CreateEventInstance(fmodEvent->Path, this);
+    system->SetEventVolumeMultiplier(EventInstance, _volumeMultiplier);
+    system->SetEventPitchMultiplier(EventInstance, _pitchMultiplier);
+    system->SetEventMaxDistance(EventInstance, _overrideDistance ? _maxDistance : -1.0f);
+    system->SetEventMinDistance(EventInstance, _overrideDistance ? _minDistance : -1.0f);
+    MarkAttributesDirty();
+
+    // Set initial parameters
+    for (int i = 0; i < InitialParameters.Count(); i++)
+    {
+        auto& parameter = InitialParameters[i];
+        if (!parameter.Id.IsValid())
+            parameter.Id = system->GetEventParameterId(EventInstance, parameter.Name);
+        if (parameter.Id.IsValid())
+            system->SetEventParameter(EventInstance, parameter.Id, parameter.Value);
+        else
+            system->SetEventParameter(EventInstance, parameter.Name, parameter.Value);
+    }
+
+    // Parameters set while the source had no instance
+    if (EventInstance)
+    {
+        for (const auto& parameter : _pendingParameters)
+        {
+            if (parameter.Id.IsValid())
+                system->SetEventParameter(EventInstance, parameter.Id, parameter.Value);
+            else
+                system->SetEventParameter(EventInstance, parameter.Name, parameter.Value);
+        }
+        _pendingParameters.Clear();
+    }
+
+    if (_playPending)
+    {
+        _playPending = false;
+        Play();
+    }
+}
+
 void FmodAudioSource::OnEventChanged()
 {
     if (Engine::IsPlayMode())
@@ -304,7 +484,14 @@ void FmodAudioSource::OnEventChanged()
         if (EventInstance)
         {
             FmodAudio::GetAudioSystem()->ReleaseEventInstance(EventInstance);
+            EventInstance = FmodEventHandle();
         }
+        _virtual = false;
+        _pendingParameters.Clear();
+
+        // Parameter ids are resolved per event description.
+        for (auto& parameter : InitialParameters)
+            parameter.Id = FmodParameterId();
     }
 }
 
@@ -317,6 +504,7 @@ void FmodAudioSource::OnTransformChanged()
 
     if (Engine::IsPlayMode())
     {
-
+        FmodAudio::SourceGrid.Update(this);
+        MarkAttributesDirty();
     }
 }
@@ -2,8 +2,10 @@
 
 #include "Engine/Content/JsonAssetReference.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Level/Actor.h"
 #include "FlaxFmod/Assets/FmodEvent.h"
+#include "FlaxFmod/Types/FmodEventHandle.h"
 #include "FlaxFmod/Types/FmodParameter.h"
 
 API_CLASS(Attributes="ActorContextMenu(\"New/Audio/Fmod Audio Source\"), ActorToolbox(\"Other\")")
@@ -11,6 +13,9 @@ class FLAXFMOD_API FmodAudioSource : public Actor
 {
 API_AUTO_SERIALIZATION();
 DECLARE_SCENE_OBJECT(FmodAudioSource);
+    friend class FmodAudio;
+    friend class FmodAudioSystem;
+    friend class FmodSourceGrid;
 
 private:
     Vector3 _previousPosition;
@@ -25,6 +30,14 @@ private:
     bool _enableBeatEvents = false;
     bool _enableMarkerEvents = true;
     bool _allowFadeout = false;
+    bool _attributesDirty = false;
+    bool _playPending = false;
+    bool _virtual = false;
+    bool _virtualOneshot = false;
+    float _virtualMaxDistance = 0.0f;
+    uint64 _gridCell = 0;
+    int32 _gridIndex = -1;
+    Array<FmodParameter> _pendingParameters;
     
 public:
 
@@ -78,9 +91,9 @@ public:
     JsonAssetReference<FmodEvent> Event;
 
     /// <summary>
-    /// The fmod event instance used for connection with the fmod backend.
+    /// The handle of the fmod event instance used for connection with the fmod backend.
     /// </summary>
-    void* EventInstance = nullptr;
+    FmodEventHandle EventInstance;
 
     /// <summary>
     /// The start time for event.
@@ -283,6 +296,14 @@ public:
     /// </summary>
     API_FUNCTION() bool IsPlaying();
 
+    /// <summary>
+    /// Gets if the source is virtual. Virtual sources are out of range of all listeners and have no event instance until they come back in range.
+    /// </summary>
+    API_FUNCTION() FORCE_INLINE bool IsVirtual() const
+    {
+        return _virtual;
+    }
+
     /// <summary>
     /// Gets if the event playing is 3D or not.
     /// </summary>
@@ -298,6 +319,26 @@ public:
     /// </summary>
     API_FUNCTION() float GetParameter(const String& parameterName);
 
+    /// <summary>
+    /// Resolves a event parameter id based on its name. Use the id to skip the name lookup on frequent updates.
+    /// </summary>
+    API_FUNCTION() FmodParameterId GetParameterId(const String& parameterName);
+
+    /// <summary>
+    /// Sets a event parameter based on its resolved id.
+    /// </summary>
+    API_FUNCTION() void SetParameter(const FmodParameterId& parameterId, float value);
+
+    /// <summary>
+    /// Gets a event parameter based on its resolved id.
+    /// </summary>
+    API_FUNCTION() float GetParameter(const FmodParameterId& parameterId);
+
+    /// <summary>
+    /// Sets multiple event parameters in a single call. Ids and values are matched by index.
+    /// </summary>
+    API_FUNCTION() void SetParameters(const Span<FmodParameterId>& parameterIds, const Span<float>& values);
+
 private:
 
     // [Actor]
@@ -312,8 +353,12 @@ private:
 #endif
 
     void OnEventLoaded();
+    void CreateInstance();
     void OnEventChanged();
     bool CheckForEvent();
+    void MarkAttributesDirty();
+    void SetPendingParameter(const String& parameterName, const FmodParameterId& parameterId, float value);
+    const FmodParameter* FindPendingParameter(const String& parameterName, const FmodParameterId& parameterId) const;
 
     void OnTransformChanged() override;
 };
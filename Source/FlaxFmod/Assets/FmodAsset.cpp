@@ -6,7 +6,10 @@ FMOD_GUID FmodAsset::GetFmodGuid() const
 {
     if (Guid == String::Empty)
         return {};
-    FMOD_GUID guid;
-    FMOD::Studio::parseID(Guid.ToStringAnsi().GetText(), &guid);
-    return guid;
+    if (Guid != _parsedGuid)
+    {
+        FMOD::Studio::parseID(Guid.ToStringAnsi().GetText(), &_fmodGuid);
+        _parsedGuid = Guid;
+    }
+    return _fmodGuid;
 }
@@ -9,10 +9,17 @@ API_CLASS() class FLAXFMOD_API FmodAsset : public ScriptingObject, public ISeria
 {
     API_AUTO_SERIALIZATION();
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(FmodAsset, ScriptingObject);
+private:
+    mutable FMOD_GUID _fmodGuid = {};
+    mutable String _parsedGuid;
+
 public:
 
     API_FIELD() String Path;
     API_FIELD() String Guid;
 
+    /// <summary>
+    /// Gets the parsed fmod guid. The result is cached until the Guid changes.
+    /// </summary>
     FMOD_GUID GetFmodGuid() const;
 };
@@ -1,15 +1,52 @@
 ﻿#include "FmodBank.h"
 
 #include "FlaxFmod/FmodAudio.h"
+#include "FlaxFmod/Types/FmodBankLoadHandle.h"
 
 void FmodBank::Load(bool loadSampleData)
 {
+    // The referenced asset keeps the data alive while this bank is loaded.
+    if (Data && !Data->WaitForLoaded())
+    {
+        FmodAudio::LoadBankFromMemory(GetBankName(), ToSpan(Data->Data), loadSampleData);
+        _loadSampleData.Add(loadSampleData);
+        return;
+    }
     FmodAudio::LoadBank(GetBankName(), loadSampleData);
+    _loadSampleData.Add(loadSampleData);
+}
+
+FmodBankLoadHandle* FmodBank::LoadAsync(bool loadSampleData)
+{
+    auto handle = FmodAudio::LoadBankAsync(GetBankName(), loadSampleData);
+    if (!handle || handle->IsFailed())
+    {
+        LoadFailed();
+        return handle;
+    }
+    if (handle->IsLoaded())
+    {
+        _loadSampleData.Add(loadSampleData);
+        Loaded();
+        return handle;
+    }
+
+    // Only loads that finish are undone by Unload, a failed load releases its references itself.
+    _pendingLoadSampleData.Add(loadSampleData);
+    handle->Loaded.BindUnique<FmodBank, &FmodBank::OnLoadHandleLoaded>(this);
+    handle->Failed.BindUnique<FmodBank, &FmodBank::OnLoadHandleFailed>(this);
+    return handle;
 }
 
 void FmodBank::Unload()
 {
-    FmodAudio::UnloadBank(GetBankName());
+    // Undo the last load so only the sample data reference it took is released.
+    bool releaseSampleData = true;
+    if (_pendingLoadSampleData.HasItems())
+        releaseSampleData = _pendingLoadSampleData.Pop();
+    else if (_loadSampleData.HasItems())
+        releaseSampleData = _loadSampleData.Pop();
+    FmodAudio::UnloadBank(GetBankName(), releaseSampleData);
 }
 
 bool FmodBank::IsLoaded()
@@ -17,6 +54,19 @@ bool FmodBank::IsLoaded()
     return FmodAudio::IsBankLoaded(GetBankName());
 }
 
+void FmodBank::OnLoadHandleLoaded()
+{
+    _loadSampleData.Add(_pendingLoadSampleData);
+    _pendingLoadSampleData.Clear();
+    Loaded();
+}
+
+void FmodBank::OnLoadHandleFailed()
+{
+    _pendingLoadSampleData.Clear();
+    LoadFailed();
+}
+
 String FmodBank::GetBankName()
 {
     auto name = Path;
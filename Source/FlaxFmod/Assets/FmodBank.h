@@ -1,6 +1,11 @@
 ﻿#pragma once
 
 #include "FmodAsset.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Content/Assets/RawDataAsset.h"
+
+class FmodBankLoadHandle;
 
 API_CLASS() class FLAXFMOD_API FmodBank : public FmodAsset
 {
@@ -8,11 +13,31 @@ API_CLASS() class FLAXFMOD_API FmodBank : public FmodAsset
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(FmodBank, FmodAsset);
 public:
 
+    /// <summary>
+    /// Optional bank file contents stored in packaged content. When set, the bank is loaded from this data instead of the bank file.
+    /// </summary>
+    API_FIELD() AssetReference<RawDataAsset> Data;
+
+    /// <summary>
+    /// Fired when this bank finishes loading asynchronously.
+    /// </summary>
+    API_EVENT() Action Loaded;
+
+    /// <summary>
+    /// Fired when this bank fails to load asynchronously.
+    /// </summary>
+    API_EVENT() Action LoadFailed;
+
     /// <summary>
     /// Loads this bank.
     /// </summary>
     API_FUNCTION() void Load(bool loadSampleData = true);
 
+    /// <summary>
+    /// Starts loading this bank without blocking.
+    /// </summary>
+    API_FUNCTION() FmodBankLoadHandle* LoadAsync(bool loadSampleData = true);
+
     /// <summary>
     /// Unloads this bank.
     /// </summary>
@@ -24,4 +49,14 @@ public:
     API_FUNCTION() bool IsLoaded();
 
     String GetBankName();
+
+private:
+    // Whether each load made through this asset requested the sample data, undone in reverse order.
+    Array<bool> _loadSampleData;
+
+    // The same for the asynchronous loads still in progress, dropped if the load fails.
+    Array<bool> _pendingLoadSampleData;
+
+    void OnLoadHandleLoaded();
+    void OnLoadHandleFailed();
 };
@@ -1,33 +1,65 @@
 ﻿#include "FmodBus.h"
 
 #include "FlaxFmod/FmodAudio.h"
+#include "FlaxFmod/FmodAudioSystem.h"
 
 float FmodBus::GetVolume() const
 {
-    return FmodAudio::GetBusVolume(Path);
+    const auto bus = GetBus();
+    if (!bus)
+        return -1.0f;
+    float volume;
+    bus->getVolume(&volume);
+    return volume;
 }
 
 void FmodBus::SetVolume(float volume) const
 {
-    FmodAudio::SetBusVolume(Path, volume);
+    if (const auto bus = GetBus())
+        bus->setVolume(volume);
 }
 
 bool FmodBus::GetMuted() const
 {
-    return FmodAudio::GetBusMute(Path);
+    const auto bus = GetBus();
+    if (!bus)
+        return false;
+    bool mute;
+    bus->getMute(&mute);
+    return mute;
 }
 
 void FmodBus::SetMuted(bool muted) const
 {
-    FmodAudio::SetBusMute(Path, muted);
+    if (const auto bus = GetBus())
+        bus->setMute(muted);
 }
 
 bool FmodBus::GetPaused() const
 {
-    return FmodAudio::IsBusPaused(Path);
+    const auto bus = GetBus();
+    if (!bus)
+        return false;
+    bool paused;
+    bus->getPaused(&paused);
+    return paused;
 }
 
 void FmodBus::SetPaused(bool paused) const
 {
-    FmodAudio::SetBusPaused(Path, paused);
+    if (const auto bus = GetBus())
+        bus->setPaused(paused);
+}
+
+FMOD::Studio::Bus* FmodBus::GetBus() const
+{
+    const auto system = FmodAudio::GetAudioSystem();
+    if (!system)
+        return nullptr;
+    if (_handleEpoch != system->GetMixerEpoch())
+    {
+        _handle = Guid.HasChars() ? system->GetBus(GetFmodGuid()) : system->GetBus(Path);
+        _handleEpoch = system->GetMixerEpoch();
+    }
+    return _handle;
 }
@@ -2,10 +2,22 @@
 
 #include "FmodAsset.h"
 
+namespace FMOD
+{
+    namespace Studio
+    {
+        class Bus;
+    }
+}
+
 API_CLASS() class FLAXFMOD_API FmodBus : public FmodAsset
 {
     API_AUTO_SERIALIZATION();
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(FmodBus, FmodAsset);
+private:
+    mutable FMOD::Studio::Bus* _handle = nullptr;
+    mutable uint32 _handleEpoch = 0;
+
 public:
 
     /// <summary>
@@ -37,4 +49,9 @@ public:
     /// Gets or sets if the bus is paused
     /// </summary>
     API_PROPERTY() void SetPaused(bool paused) const;
+
+    /// <summary>
+    /// Gets the fmod bus. The handle is cached until banks are loaded or unloaded.
+    /// </summary>
+    FMOD::Studio::Bus* GetBus() const;
 };
@@ -1,11 +1,74 @@
 ﻿#pragma once
 
 #include "FmodAsset.h"
+#include "Engine/Core/Collections/Array.h"
+#include "FlaxFmod/Types/FmodEventHandle.h"
+
+/// <summary>
+/// Which playing instance is stopped to start a new one when an event reaches its instance limit.
+/// </summary>
+API_ENUM() enum class FmodEventStealMode
+{
+    /// <summary>
+    /// Nothing is stopped, the new instance is rejected.
+    /// </summary>
+    None,
+
+    /// <summary>
+    /// The instance that started first is stopped.
+    /// </summary>
+    Oldest,
+
+    /// <summary>
+    /// The least audible instance is stopped.
+    /// </summary>
+    Quietest,
+
+    /// <summary>
+    /// The instance furthest from the listeners is stopped.
+    /// </summary>
+    Furthest,
+};
 
 API_CLASS() class FLAXFMOD_API FmodEvent : public FmodAsset
 {
     API_AUTO_SERIALIZATION();
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(FmodEvent, FmodAsset);
+    friend class FmodAudioSystem;
+private:
+    mutable Array<FmodEventHandle> _limitedInstances;
+    mutable double _lastStartTime = -1000000.0;
+
+public:
+
+    /// <summary>
+    /// The max number of instances of the event started by audio sources or PlayEventAtLocation that can play at once. Zero is unlimited.
+    /// Checked before any instance is created, unlike the limits authored in fmod studio.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Limits\"), Limit(0)") int32 MaxInstances = 0;
+
+    /// <summary>
+    /// The min time in seconds between two starts of the event. Starts sooner than that are rejected.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Limits\"), Limit(0)") float MinRetriggerInterval = 0.0f;
+
+    /// <summary>
+    /// Which playing instance is stopped when MaxInstances is reached.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Limits\")") FmodEventStealMode StealMode = FmodEventStealMode::None;
+
+    /// <summary>
+    /// The number of instances created ahead of time and reused once the event is first used. Stopped one-shots and released audio source instances go back to the pool up to this count. Zero disables pooling.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Pool\"), Limit(0)") int32 WarmInstances = 0;
+
+    /// <summary>
+    /// Returns true if the event has any instance limit set.
+    /// </summary>
+    bool HasLimits() const
+    {
+        return MaxInstances > 0 || MinRetriggerInterval > 0.0f;
+    }
 
     /// <summary>
     /// Gets the event length.
@@ -1,13 +1,33 @@
 ﻿#include "FmodVca.h"
 
 #include "FlaxFmod/FmodAudio.h"
+#include "FlaxFmod/FmodAudioSystem.h"
 
 float FmodVca::GetVolume() const
 {
-    return FmodAudio::GetVCAVolume(Path);
+    const auto vca = GetVCA();
+    if (!vca)
+        return -1.0f;
+    float volume;
+    vca->getVolume(&volume);
+    return volume;
 }
 
 void FmodVca::SetVolume(float volume) const
 {
-    FmodAudio::SetVCAVolume(Path, volume);
+    if (const auto vca = GetVCA())
+        vca->setVolume(volume);
+}
+
+FMOD::Studio::VCA* FmodVca::GetVCA() const
+{
+    const auto system = FmodAudio::GetAudioSystem();
+    if (!system)
+        return nullptr;
+    if (_handleEpoch != system->GetMixerEpoch())
+    {
+        _handle = Guid.HasChars() ? system->GetVCA(GetFmodGuid()) : system->GetVCA(Path);
+        _handleEpoch = system->GetMixerEpoch();
+    }
+    return _handle;
 }
@@ -2,10 +2,22 @@
 
 #include "FmodAsset.h"
 
+namespace FMOD
+{
+    namespace Studio
+    {
+        class VCA;
+    }
+}
+
 API_CLASS() class FLAXFMOD_API FmodVca : public FmodAsset
 {
     API_AUTO_SERIALIZATION();
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(FmodVca, FmodAsset);
+private:
+    mutable FMOD::Studio::VCA* _handle = nullptr;
+    mutable uint32 _handleEpoch = 0;
+
 
 public:
 
@@ -18,4 +30,9 @@ public:
     /// Gets or sets the VCA volume.
     /// </summary>
     API_PROPERTY() void SetVolume(float volume) const;
+
+    /// <summary>
+    /// Gets the fmod VCA. The handle is cached until banks are loaded or unloaded.
+    /// </summary>
+    FMOD::Studio::VCA* GetVCA() const;
 };
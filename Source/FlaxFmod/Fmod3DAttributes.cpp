@@ -0,0 +1,65 @@
+﻿#include "Fmod3DAttributes.h"
+
+#if USE_LARGE_WORLDS && defined(__AVX__)
+#define FMOD_ATTRIBUTES_AVX 1
+#include <immintrin.h>
+#elif PLATFORM_SIMD_SSE2
+#define FMOD_ATTRIBUTES_SSE2 1
+#include <emmintrin.h>
+#endif
+
+static_assert(sizeof(FmodTransform) == sizeof(Real) * 12, "FmodTransform must be tightly packed.");
+static_assert(sizeof(FMOD_3D_ATTRIBUTES) == sizeof(float) * 12, "FMOD_3D_ATTRIBUTES must be tightly packed.");
+
+void Fmod3DAttributes::Convert(const FmodTransform* transforms, FMOD_3D_ATTRIBUTES* attributes, int32 count, const Vector3& origin)
+{
+    // Each transform is 12 components, the origin is only subtracted from the first 3.
+    const Real* src = reinterpret_cast<const Real*>(transforms);
+    float* dst = reinterpret_cast<float*>(attributes);
+    int32 i = 0;
+
+#if FMOD_ATTRIBUTES_AVX
+    const __m256d originXYZ = _mm256_setr_pd(origin.X, origin.Y, origin.Z, 0.0);
+    for (; i < count; i++, src += 12, dst += 12)
+    {
+        const __m256d a = _mm256_sub_pd(_mm256_loadu_pd(src), originXYZ);
+        const __m256d b = _mm256_loadu_pd(src + 4);
+        const __m256d c = _mm256_loadu_pd(src + 8);
+        _mm_storeu_ps(dst, _mm256_cvtpd_ps(a));
+        _mm_storeu_ps(dst + 4, _mm256_cvtpd_ps(b));
+        _mm_storeu_ps(dst + 8, _mm256_cvtpd_ps(c));
+    }
+#elif FMOD_ATTRIBUTES_SSE2 && USE_LARGE_WORLDS
+    const __m128d originXY = _mm_setr_pd(origin.X, origin.Y);
+    const __m128d originZ = _mm_setr_pd(origin.Z, 0.0);
+    for (; i < count; i++, src += 12, dst += 12)
+    {
+        const __m128 a = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src), originXY));
+        const __m128 b = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src + 2), originZ));
+        const __m128 c = _mm_cvtpd_ps(_mm_loadu_pd(src + 4));
+        const __m128 d = _mm_cvtpd_ps(_mm_loadu_pd(src + 6));
+        const __m128 e = _mm_cvtpd_ps(_mm_loadu_pd(src + 8));
+        const __m128 f = _mm_cvtpd_ps(_mm_loadu_pd(src + 10));
+        _mm_storeu_ps(dst, _mm_movelh_ps(a, b));
+        _mm_storeu_ps(dst + 4, _mm_movelh_ps(c, d));
+        _mm_storeu_ps(dst + 8, _mm_movelh_ps(e, f));
+    }
+#elif FMOD_ATTRIBUTES_SSE2
+    const __m128 originXYZ = _mm_setr_ps(origin.X, origin.Y, origin.Z, 0.0f);
+    for (; i < count; i++, src += 12, dst += 12)
+    {
+        _mm_storeu_ps(dst, _mm_sub_ps(_mm_loadu_ps(src), originXYZ));
+        _mm_storeu_ps(dst + 4, _mm_loadu_ps(src + 4));
+        _mm_storeu_ps(dst + 8, _mm_loadu_ps(src + 8));
+    }
+#endif
+
+    for (; i < count; i++, src += 12, dst += 12)
+    {
+        dst[0] = static_cast<float>(src[0] - origin.X);
+        dst[1] = static_cast<float>(src[1] - origin.Y);
+        dst[2] = static_cast<float>(src[2] - origin.Z);
+        for (int32 j = 3; j < 12; j++)
+            dst[j] = static_cast<float>(src[j]);
+    }
+}
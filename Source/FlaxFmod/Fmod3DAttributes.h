@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#include "fmod_common.h"
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Math/Vector3.h"
+
+/// <summary>
+/// The world space transform of a source or listener, packed in the same order as FMOD_3D_ATTRIBUTES. Uses double precision with large worlds.
+/// </summary>
+struct FmodTransform
+{
+    Vector3 Position;
+    Vector3 Velocity;
+    Vector3 Forward;
+    Vector3 Up;
+};
+
+/// <summary>
+/// Converts packed world space transforms to fmod 3D attributes.
+/// </summary>
+class Fmod3DAttributes
+{
+public:
+    /// <summary>
+    /// Converts the transforms to fmod attributes. The origin is subtracted from the positions before they are narrowed to float, so positions far from the world origin keep their precision.
+    /// Uses AVX or SSE2 when available.
+    /// </summary>
+    static void Convert(const FmodTransform* transforms, FMOD_3D_ATTRIBUTES* attributes, int32 count, const Vector3& origin);
+
+    /// <summary>
+    /// Converts a single world space position to an fmod vector relative to the origin.
+    /// </summary>
+    static FMOD_VECTOR ToFmodVector(const Vector3& position, const Vector3& origin)
+    {
+        return { static_cast<float>(position.X - origin.X), static_cast<float>(position.Y - origin.Y), static_cast<float>(position.Z - origin.Z) };
+    }
+};
@@ -12,22 +12,56 @@ FmodAudioSystem* FmodAudio::_audioSystem = nullptr;
 Array<FmodAudioListener*> FmodAudio::Listeners;
 FmodAudioListener* FmodAudio::ActiveListener;
 Array<FmodAudioSource*> FmodAudio::Sources;
+Array<FmodAudioSource*> FmodAudio::DirtySources;
+FmodSourceGrid FmodAudio::SourceGrid;
 Delegate<> FmodAudio::AudioDeviceListChanged;
 Delegate<> FmodAudio::AudioDeviceLost;
 Delegate<> FmodAudio::ActiveAudioDeviceChanged;
+Delegate<String> FmodAudio::BankLoaded;
+Delegate<String> FmodAudio::BankLoadFailed;
+Delegate<String> FmodAudio::BankUnloaded;
 Array<FmodAudioDevice> FmodAudio::AudioDevices;
 int FmodAudio::_activeAudioDeviceIndex;
+Array<FmodAudioSource*> FmodAudio::_pooledOneShots;
+Array<FmodAudioSource*> FmodAudio::_activeOneShots;
 
 void FmodAudio::Initialize()
 {
     _audioSystem = PluginManager::GetPlugin<FmodAudioSystem>();
     _activeAudioDeviceIndex = -1;
+    SourceGrid.SetCellSize(FmodAudioSettings::Get()->SourceGridCellSize);
 }
 
 void FmodAudio::Deinitialize()
 {
     _activeAudioDeviceIndex = -1;
     _audioSystem = nullptr;
+    _pooledOneShots.Clear();
+    _activeOneShots.Clear();
+    SourceGrid.Clear();
+}
+
+void FmodAudio::UpdateOneShots()
+{
+    for (int i = _activeOneShots.Count() - 1; i >= 0; i--)
+    {
+        // Sources waiting for their bank or for a listener to come in range have no instance yet but still have to play.
+        auto source = _activeOneShots[i];
+        if (source->_playPending || !_audioSystem->IsEventStopped(source->EventInstance))
+            continue;
+
+        _activeOneShots.RemoveAt(i);
+        source->SetIsActive(false);
+        source->SetParent(source->GetScene(), false);
+        _pooledOneShots.Add(source);
+    }
+}
+
+void FmodAudio::OnOneShotDeleted(ScriptingObject* object)
+{
+    auto source = static_cast<FmodAudioSource*>(object);
+    _pooledOneShots.Remove(source);
+    _activeOneShots.Remove(source);
 }
 
 FmodAudioSystem* FmodAudio::GetAudioSystem()
@@ -57,16 +91,67 @@ int FmodAudio::GetActiveAudioDevice()
 
 void FmodAudio::PlayEventAtLocation(const JsonAssetReference<FmodEvent>& fmodEvent, const Vector3& location)
 {
-    if (!_audioSystem)
+    if (!_audioSystem || !fmodEvent || fmodEvent->WaitForLoaded())
         return;
 
-    // TODO: object pooling for better memory efficiency
-    FmodAudioSource* source = New<FmodAudioSource>();
-    Level::SpawnActor(source);
-    source->Event = fmodEvent;
-    source->SetPosition(location);
+    const auto event = fmodEvent.GetInstance();
+    if (!event)
+        return;
+    _audioSystem->PlayOneShot(event, location);
+}
+
+Array<FmodAudioSource*> FmodAudio::FindSourcesInRadius(const Vector3& center, float radius)
+{
+    Array<FmodAudioSource*> result;
+    SourceGrid.FindInRadius(center, radius, result);
+    return result;
+}
+
+Array<FmodAudioSource*> FmodAudio::FindNearestSources(const Vector3& position, int32 count, float maxDistance)
+{
+    Array<FmodAudioSource*> result;
+    SourceGrid.FindNearest(position, count, maxDistance, result);
+    return result;
+}
+
+FmodAudioSource* FmodAudio::PlayEventAttached(const JsonAssetReference<FmodEvent>& fmodEvent, Actor* target)
+{
+    if (!_audioSystem || !fmodEvent || !target)
+        return nullptr;
+
+    // Prefer a pooled source that already holds an instance of this event.
+    FmodAudioSource* source = nullptr;
+    for (int i = 0; i < _pooledOneShots.Count(); i++)
+    {
+        if (_pooledOneShots[i]->Event.Get() == fmodEvent.Get())
+        {
+            source = _pooledOneShots[i];
+            _pooledOneShots.RemoveAt(i);
+            break;
+        }
+    }
+    if (!source && _pooledOneShots.HasItems())
+        source = _pooledOneShots.Pop();
+
+    if (source)
+    {
+        source->SetParent(target, false);
+        source->Event = fmodEvent;
+    }
+    else
+    {
+        // The event is set before spawning since the source looks it up when it begins play.
+        source = New<FmodAudioSource>();
+        source->HideFlags = HideFlags::FullyHidden;
+        source->Event = fmodEvent;
+        source->Deleted.Bind<&FmodAudio::OnOneShotDeleted>();
+        Level::SpawnActor(source, target);
+    }
+    source->SetLocalTransform(Transform::Identity);
+    source->SetIsActive(true);
     source->Play();
-    source->DeleteObject(source->GetEventLength(), true);
+    _activeOneShots.Add(source);
+    return source;
 }
 
 void FmodAudio::SetMasterVolume(float volume)
@@ -125,6 +210,36 @@ float FmodAudio::GetGlobalParameter(const String& name)
     return _audioSystem->GetGlobalParameter(name);
 }
 
+FmodParameterId FmodAudio::GetGlobalParameterId(const String& name)
+{
+    if (!_audioSystem)
+        return FmodParameterId();
+    return _audioSystem->GetGlobalParameterId(name);
+}
+
+void FmodAudio::SetGlobalParameter(const FmodParameterId& id, float value)
+{
+    if (!_audioSystem)
+        return;
+    _audioSystem->SetGlobalParameter(id, value);
+}
+
+float FmodAudio::GetGlobalParameter(const FmodParameterId& id)
+{
+    if (!_audioSystem)
+        return -1.0f;
+    return _audioSystem->GetGlobalParameter(id);
+}
+
+void FmodAudio::SetGlobalParameters(const Span<FmodParameterId>& ids, const Span<float>& values)
+{
+    if (!_audioSystem)
+        return;
+    if (ids.Length() != values.Length())
+        FMODLOG(Warning, "Global parameter ids count ({}) does not match values count ({}).", ids.Length(), values.Length());
+    _audioSystem->SetGlobalParameters(ids.Get(), values.Get(), Math::Min(ids.Length(), values.Length()));
+}
+
 void FmodAudio::LoadBank(const String& bankName, bool loadSampleData)
 {
     if (!_audioSystem)
@@ -132,6 +247,20 @@ void FmodAudio::LoadBank(const String& bankName, bool loadSampleData)
    _audioSystem->LoadBank(bankName, loadSampleData);
 }
 
+FmodBankLoadHandle* FmodAudio::LoadBankAsync(const String& bankName, bool loadSampleData)
+{
+    if (!_audioSystem)
+        return nullptr;
+    return _audioSystem->LoadBankAsync(bankName, loadSampleData);
+}
+
+void FmodAudio::LoadBankFromMemory(const String& bankName, const Span<byte>& data, bool loadSampleData)
+{
+    if (!_audioSystem)
+        return;
+    _audioSystem->LoadBankMemory(bankName, data.Get(), data.Length(), loadSampleData);
+}
+
 bool FmodAudio::IsBankLoaded(const String& bankName)
 {
     if (!_audioSystem)
@@ -139,11 +268,39 @@ bool FmodAudio::IsBankLoaded(const String& bankName)
     return _audioSystem->CheckBankLoaded(bankName);
 }
 
-void FmodAudio::UnloadBank(const String& bankName)
+void FmodAudio::UnloadBank(const String& bankName, bool releaseSampleData)
 {
     if (!_audioSystem)
         return;
-    _audioSystem->UnloadBank(bankName);
+    _audioSystem->UnloadBank(bankName, releaseSampleData);
+}
+
+void FmodAudio::LoadBankSampleData(const String& bankName)
+{
+    if (!_audioSystem)
+        return;
+    _audioSystem->LoadBankSampleData(bankName);
+}
+
+void FmodAudio::UnloadBankSampleData(const String& bankName)
+{
+    if (!_audioSystem)
+        return;
+    _audioSystem->UnloadBankSampleData(bankName);
+}
+
+uint64 FmodAudio::GetBankSampleDataSize(const String& bankName)
+{
+    if (!_audioSystem)
+        return 0;
+    return _audioSystem->GetBankSampleDataSize(bankName);
+}
+
+uint64 FmodAudio::GetSampleDataMemoryUsage()
+{
+    if (!_audioSystem)
+        return 0;
+    return _audioSystem->GetSampleDataMemoryUsage();
 }
 
 void FmodAudio::SetBusVolume(JsonAssetReference<FmodBus> busAsset, float volumeMultiplier)
@@ -153,7 +310,7 @@ void FmodAudio::SetBusVolume(JsonAssetReference<FmodBus> busAsset, float volumeM
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return;
-    _audioSystem->SetBusVolumeMultiplier(bus->Path, volumeMultiplier);
+    bus->SetVolume(volumeMultiplier);
 }
 
 void FmodAudio::SetBusVolume(const String& busPath, float volumeMultiplier)
@@ -170,7 +327,7 @@ float FmodAudio::GetBusVolume(JsonAssetReference<FmodBus> busAsset)
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return -1.0f;
-    return _audioSystem->GetBusVolumeMultiplier(bus->Path);
+    return bus->GetVolume();
 }
 
 float FmodAudio::GetBusVolume(const String& busPath)
@@ -187,7 +344,7 @@ bool FmodAudio::GetBusMute(JsonAssetReference<FmodBus> busAsset)
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return false;
-    return _audioSystem->GetBusMute(bus->Path);
+    return bus->GetMuted();
 }
 
 bool FmodAudio::GetBusMute(const String& busPath)
@@ -204,7 +361,7 @@ void FmodAudio::SetBusMute(JsonAssetReference<FmodBus> busAsset, bool value)
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return;
-    _audioSystem->SetBusMute(bus->Path, value);
+    bus->SetMuted(value);
 }
 
 void FmodAudio::SetBusMute(const String& busPath, bool value)
@@ -221,7 +378,7 @@ void FmodAudio::SetBusPaused(JsonAssetReference<FmodBus> busAsset, bool value)
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return;
-    _audioSystem->SetBusPaused(bus->Path, value);
+    bus->SetPaused(value);
 }
 
 void FmodAudio::SetBusPaused(const String& busPath, bool value)
@@ -238,7 +395,7 @@ bool FmodAudio::IsBusPaused(JsonAssetReference<FmodBus> busAsset)
     auto* bus = busAsset->GetInstance<FmodBus>();
     if (!bus)
         return false;
-    return _audioSystem->IsBusPaused(bus->Path);
+    return bus->GetPaused();
 }
 
 bool FmodAudio::IsBusPaused(const String& busPath)
@@ -255,7 +412,7 @@ void FmodAudio::SetVCAVolume(JsonAssetReference<FmodVca> vcaAsset, float volumeS
     auto* vca = vcaAsset->GetInstance<FmodVca>();
     if (!vca)
         return;
-    _audioSystem->SetVCAVolumeMultiplier(vca->Path, volumeScale);
+    vca->SetVolume(volumeScale);
 }
 
 void FmodAudio::SetVCAVolume(const String& vcaPath, float volumeScale)
@@ -272,7 +429,7 @@ float FmodAudio::GetVCAVolume(JsonAssetReference<FmodVca> vcaAsset)
     auto* vca = vcaAsset->GetInstance<FmodVca>();
     if (!vca)
         return -1.0f;
-    return _audioSystem->GetVCAVolumeMultiplier(vca->Path);
+    return vca->GetVolume();
 }
 
 float FmodAudio::GetVCAVolume(const String& vcaPath)
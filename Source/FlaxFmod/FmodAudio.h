@@ -3,17 +3,23 @@
 #include "Assets/FmodBus.h"
 #include "Assets/FmodEvent.h"
 #include "Assets/FmodVca.h"
+#include "FmodSourceGrid.h"
+#include "Types/FmodParameterId.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Audio/AudioDevice.h"
 #include "Engine/Content/JsonAssetReference.h"
 
 #define FMODLOG(messageType, format, ...) Log::Logger::Write(LogType::messageType, ::String::Format(String("[Fmod] ").Append(String(format)).GetText(), ##__VA_ARGS__))
 
+class Actor;
+class ScriptingObject;
 class FmodAudioDevice;
 class FmodAudioSource;
 class FmodAudioListener;
 class FmodAudioSystem;
+class FmodBankLoadHandle;
 API_CLASS(Static) class FLAXFMOD_API FmodAudio
 {
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(FmodAudio);
@@ -22,9 +28,13 @@ API_CLASS(Static) class FLAXFMOD_API FmodAudio
 private:
     static FmodAudioSystem* _audioSystem;
     static int _activeAudioDeviceIndex;
+    static Array<FmodAudioSource*> _pooledOneShots;
+    static Array<FmodAudioSource*> _activeOneShots;
 
     static void Initialize();
     static void Deinitialize();
+    static void UpdateOneShots();
+    static void OnOneShotDeleted(ScriptingObject* object);
     
 public:
     /// <summary>
@@ -33,7 +43,7 @@ public:
     API_PROPERTY() static FmodAudioSystem* GetAudioSystem();
 
     /// <summary>
-    /// A list of the enabled fmod listeners.
+    /// A list of the enabled fmod listeners. Up to FMOD_MAX_LISTENERS are mixed, in the order they were enabled.
     /// </summary>
     static Array<FmodAudioListener*> Listeners;
 
@@ -47,6 +57,16 @@ public:
     /// </summary>
     API_FIELD(ReadOnly) static Array<FmodAudioSource*> Sources;
 
+    /// <summary>
+    /// A list of the enabled fmod audio sources whose 3D attributes changed since the last update.
+    /// </summary>
+    static Array<FmodAudioSource*> DirtySources;
+
+    /// <summary>
+    /// The spatial grid of the enabled fmod audio sources.
+    /// </summary>
+    static FmodSourceGrid SourceGrid;
+
     /// <summary>
     /// Fired when an audio device is lost.
     /// </summary>
@@ -62,6 +82,21 @@ public:
     /// </summary>
     API_EVENT() static Action ActiveAudioDeviceChanged;
 
+    /// <summary>
+    /// Fired when a bank finishes loading. Passes the bank path.
+    /// </summary>
+    API_EVENT() static Delegate<String> BankLoaded;
+
+    /// <summary>
+    /// Fired when a bank fails to load asynchronously. Passes the bank path.
+    /// </summary>
+    API_EVENT() static Delegate<String> BankLoadFailed;
+
+    /// <summary>
+    /// Fired when fmod finished unloading a bank, during an update after the last unload request. Passes the bank path. Memory the bank was loaded from can be freed from then on.
+    /// </summary>
+    API_EVENT() static Delegate<String> BankUnloaded;
+
     /// <summary>
     /// A list of the connected audio devices.
     /// </summary>
@@ -78,11 +113,27 @@ public:
     API_FUNCTION() static int GetActiveAudioDevice();
 
     /// <summary>
-    /// Plays an event at the specified location. Will spawn an audio source at the location for the duration of the event.
+    /// Plays an event at the specified location without spawning an actor. The event instance is released once it finishes.
     /// This is good for one-shot events.
     /// </summary>
     API_FUNCTION() static void PlayEventAtLocation(const JsonAssetReference<FmodEvent>& fmodEvent, const Vector3& location);
 
+    /// <summary>
+    /// Plays an event on a pooled audio source attached to the target so it follows the target's transform.
+    /// The source is returned to the pool once the event stops. This is good for one-shot events on moving actors.
+    /// </summary>
+    API_FUNCTION() static FmodAudioSource* PlayEventAttached(const JsonAssetReference<FmodEvent>& fmodEvent, Actor* target);
+
+    /// <summary>
+    /// Finds the enabled audio sources within the radius of the center. The result is not sorted.
+    /// </summary>
+    API_FUNCTION() static Array<FmodAudioSource*> FindSourcesInRadius(const Vector3& center, float radius);
+
+    /// <summary>
+    /// Finds up to count enabled audio sources nearest to the position and within the max distance, sorted from the nearest.
+    /// </summary>
+    API_FUNCTION() static Array<FmodAudioSource*> FindNearestSources(const Vector3& position, int32 count, float maxDistance = MAX_float);
+
     /// <summary>
     /// Sets the master audio channel volume.
     /// </summary>
@@ -123,11 +174,44 @@ public:
     /// </summary>
     API_FUNCTION() static float GetGlobalParameter(const String& name);
 
+    /// <summary>
+    /// Resolves a global FMOD parameter id based on name. Use the id to skip the name lookup on frequent updates.
+    /// </summary>
+    API_FUNCTION() static FmodParameterId GetGlobalParameterId(const String& name);
+
+    /// <summary>
+    /// Sets a global FMOD parameter based on its resolved id.
+    /// </summary>
+    API_FUNCTION() static void SetGlobalParameter(const FmodParameterId& id, float value);
+
+    /// <summary>
+    /// Gets a global FMOD parameter based on its resolved id.
+    /// </summary>
+    API_FUNCTION() static float GetGlobalParameter(const FmodParameterId& id);
+
+    /// <summary>
+    /// Sets multiple global FMOD parameters in a single call. Ids and values are matched by index.
+    /// </summary>
+    API_FUNCTION() static void SetGlobalParameters(const Span<FmodParameterId>& ids, const Span<float>& values);
+
     /// <summary>
     /// Loads a bank based on the bank name. This will resolve the path.
     /// </summary>
     API_FUNCTION() static void LoadBank(const String& bankName, bool loadSampleData);
 
+    /// <summary>
+    /// Starts loading a bank based on the bank name without blocking. This will resolve the path. Sources using events from the bank create their instances once it is loaded.
+    /// Requests for a bank that is already loading share the same handle. If the load fails, all of them are undone and the bank must not be unloaded.
+    /// </summary>
+    /// <returns>The load handle, or null if the bank could not be found or failed to start loading. The handle is destroyed right after it fails, or when the bank is unloaded.</returns>
+    API_FUNCTION() static FmodBankLoadHandle* LoadBankAsync(const String& bankName, bool loadSampleData);
+
+    /// <summary>
+    /// Loads a bank from memory. Memory aligned to 32 bytes is used in place, otherwise it is copied.
+    /// Memory used in place must stay valid until fmod finished unloading the bank, which is later than UnloadBank. Free it once BankUnloaded fires for the bank.
+    /// </summary>
+    API_FUNCTION() static void LoadBankFromMemory(const String& bankName, const Span<byte>& data, bool loadSampleData);
+
     /// <summary>
     /// Returns true if the bank is loaded based on the bank name. This will resolve the path.
     /// </summary>
@@ -136,7 +220,29 @@ public:
     /// <summary>
     /// Unloads a bank based on the bank name. This will resolve the path.
     /// </summary>
-    API_FUNCTION() static void UnloadBank(const String& bankName);
+    /// <param name="bankName">The bank name.</param>
+    /// <param name="releaseSampleData">Whether the load being undone requested the sample data. Releases the sample data reference it took.</param>
+    API_FUNCTION() static void UnloadBank(const String& bankName, bool releaseSampleData = true);
+
+    /// <summary>
+    /// Adds a reference to the sample data of a loaded bank, loading it if needed. This will resolve the path.
+    /// </summary>
+    API_FUNCTION() static void LoadBankSampleData(const String& bankName);
+
+    /// <summary>
+    /// Releases a reference to the sample data of a loaded bank. Unreferenced sample data is evicted when over the memory budget. This will resolve the path.
+    /// </summary>
+    API_FUNCTION() static void UnloadBankSampleData(const String& bankName);
+
+    /// <summary>
+    /// Gets the estimated sample data memory used by a bank in bytes. Returns 0 if the sample data is not loaded. This will resolve the path.
+    /// </summary>
+    API_FUNCTION() static uint64 GetBankSampleDataSize(const String& bankName);
+
+    /// <summary>
+    /// Gets the estimated sample data memory used by all loaded banks in bytes. Sums the estimated sizes of the banks with sample data loaded.
+    /// </summary>
+    API_PROPERTY() static uint64 GetSampleDataMemoryUsage();
 
     /// <summary>
     /// Sets a Bus volume multiplier.
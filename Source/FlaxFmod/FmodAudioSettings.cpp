@@ -5,4 +5,25 @@
 
 IMPLEMENT_GAME_SETTINGS_GETTER(FmodAudioSettings, "FmodAudioSettings");
 
+const FmodInitSettings& FmodAudioSettings::GetInitSettings() const
+{
+#if BUILD_DEBUG
+    const FmodBuildConfiguration configuration = FmodBuildConfiguration::Debug;
+#elif BUILD_DEVELOPMENT
+    const FmodBuildConfiguration configuration = FmodBuildConfiguration::Development;
+#else
+    const FmodBuildConfiguration configuration = FmodBuildConfiguration::Release;
+#endif
+    for (int32 i = InitSettingsOverrides.Count() - 1; i >= 0; i--)
+    {
+        const auto& settingsOverride = InitSettingsOverrides[i];
+        if (settingsOverride.Configuration != FmodBuildConfiguration::Any && settingsOverride.Configuration != configuration)
+            continue;
+        if (settingsOverride.Platforms.HasItems() && !settingsOverride.Platforms.Contains(PLATFORM_TYPE))
+            continue;
+        return settingsOverride.Settings;
+    }
+    return InitSettings;
+}
+
 
@@ -4,6 +4,49 @@
 #include "Engine/Core/Config/Settings.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Types/String.h"
+#include "Types/FmodInitSettings.h"
+
+/// <summary>
+/// How the bank files are read.
+/// </summary>
+API_ENUM() enum class FmodBankLoadMode
+{
+    /// <summary>
+    /// Fmod opens the bank files itself.
+    /// </summary>
+    File,
+
+    /// <summary>
+    /// The bank files are streamed through Flax's file system.
+    /// </summary>
+    FileSystem,
+
+    /// <summary>
+    /// The bank files are memory mapped and used in place without extra copies.
+    /// </summary>
+    MemoryMapped,
+};
+
+/// <summary>
+/// The point in the engine frame where the audio system is updated.
+/// </summary>
+API_ENUM() enum class FmodUpdateStage
+{
+    /// <summary>
+    /// Updated with the scripts update.
+    /// </summary>
+    Update,
+
+    /// <summary>
+    /// Updated with the scripts late update, so transforms changed in late update are sent in the same frame.
+    /// </summary>
+    LateUpdate,
+
+    /// <summary>
+    /// The game state is sent with the scripts update and the studio update runs on the job system in parallel with the rest of the frame. Its callbacks are fired on the next update.
+    /// </summary>
+    Job,
+};
 
 API_CLASS() class FLAXFMOD_API FmodAudioSettings : public SettingsBase
 {
@@ -64,6 +107,11 @@ public:
     /// </summary>
     API_FIELD(Attributes="EditorDisplay(\"Editor\")") String FmodStudioInstallLocation = TEXT("C:\\Program Files/FMOD SoundSystem/FMOD Studio 2.03.08"); // Todo: make this a file path editor
 
+    /// <summary>
+    /// Editor Only. The radius around a selected listener in which the distances of audio sources are drawn while playing, in world units. Zero draws all sources.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Editor\"), Limit(0)") float ListenerDebugDrawRadius = 0.0f;
+
     // Init settings
 
     /// <summary>
@@ -75,4 +123,74 @@ public:
     /// Loads the sample data from banks when they are loaded. Increases memory usage.
     /// </summary>
     API_FIELD(Attributes="EditorDisplay(\"Init\")") bool PreloadBankSampleData = true;
+
+    /// <summary>
+    /// Loads the non-master banks without blocking initialization. The master banks are always loaded synchronously.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Init\")") bool LoadBanksAsync = false;
+
+    /// <summary>
+    /// How the bank files are read.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Init\")") FmodBankLoadMode BankLoadMode = FmodBankLoadMode::File;
+
+    /// <summary>
+    /// The settings used to initialize the fmod system when no override applies.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Init\")") FmodInitSettings InitSettings;
+
+    /// <summary>
+    /// The init settings used on specific platforms and build configurations. The last matching override is used.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Init\")") Array<FmodInitSettingsOverride> InitSettingsOverrides;
+
+    // Update settings
+
+    /// <summary>
+    /// The point in the engine frame where the audio system is updated. Use with the SynchronousUpdate studio init flag to run the studio processing there instead of on fmod's studio thread, removing a frame of command latency.
+    /// Without the flag the stage only moves when the commands are sent to the studio thread. With the Job stage, the event callbacks (stopped, marker, beat, ...) are fired one frame later, on the next update.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\")") FmodUpdateStage UpdateStage = FmodUpdateStage::Update;
+
+    /// <summary>
+    /// Gathers the 3D attributes of moved audio sources in parallel on the job system. Only used when at least ParallelSourceUpdateThreshold sources moved in the frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\")") bool ParallelSourceUpdate = true;
+
+    /// <summary>
+    /// The number of moved audio sources in a frame required to gather their 3D attributes in parallel.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\"), Limit(1)") int ParallelSourceUpdateThreshold = 512;
+
+    /// <summary>
+    /// Large worlds only. The size of the cells the audio origin snaps to, in world units. Positions are sent to fmod relative to the center of the cell the active listener is in, and all sources are sent again only when the listener enters another cell. Zero disables rebasing.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\"), Limit(0)") float AudioOriginCellSize = 100000.0f;
+
+    /// <summary>
+    /// The size of the cells of the spatial grid used for audio source proximity queries, in world units. Best set close to the typical query radius.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\"), Limit(1)") float SourceGridCellSize = 5000.0f;
+
+    /// <summary>
+    /// Keeps audio sources with 3D events virtual, without an fmod event instance, while they are out of range of all listeners. Parameters set on the source, and the values its instance had when it went virtual, are applied after the initial parameters when its instance is created. Looping events restart when the source comes back in range.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\")") bool VirtualizeDistantSources = false;
+
+    /// <summary>
+    /// The distance margin in world units used when virtualizing sources. A source gets its instance within the event max distance plus this margin, and loses it farther than the max distance plus twice the margin.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Update\"), Limit(0)") float VirtualizationMargin = 500.0f;
+
+    // Memory settings
+
+    /// <summary>
+    /// The sample data memory budget in megabytes. When exceeded, the sample data of banks that are no longer referenced is unloaded starting with the least recently used. Zero disables eviction.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Memory\"), Limit(0)") int SampleDataMemoryBudget = 0;
+
+    /// <summary>
+    /// Gets the init settings for the current platform and build configuration.
+    /// </summary>
+    const FmodInitSettings& GetInitSettings() const;
 };
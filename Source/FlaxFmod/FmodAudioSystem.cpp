@@ -2,6 +2,9 @@
 
 #include "FmodAudio.h"
 #include "Types/FmodAudioDevice.h"
+#include "Types/FmodBankLoadHandle.h"
+#include "Types/FmodBankResidency.h"
+#include "FmodBankFileSystem.h"
 #include "FmodAudioSettings.h"
 #include "Engine/Platform/Types.h"
 #include "fmod_errors.h"
@@ -12,8 +15,19 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Threading/JobSystem.h"
 
-Dictionary<FMOD::Studio::EventInstance*, FmodAudioSource*> FmodAudioSystem::EventMap;
+FmodEventCallbackQueue FmodAudioSystem::EventCallbacks;
+
+static void GetOneShotAttributes(const Vector3& position, const Vector3& origin, FMOD_3D_ATTRIBUTES& attributes)
+{
+    attributes.position = Fmod3DAttributes::ToFmodVector(position, origin);
+    attributes.velocity = { 0.0f, 0.0f, 0.0f };
+    attributes.forward = { static_cast<float>(Vector3::Forward.X), static_cast<float>(Vector3::Forward.Y), static_cast<float>(Vector3::Forward.Z) };
+    attributes.up = { static_cast<float>(Vector3::Up.X), static_cast<float>(Vector3::Up.Y), static_cast<float>(Vector3::Up.Z) };
+}
 
 FmodAudioSystem::FmodAudioSystem(const SpawnParams& params)
     : GamePlugin(params)
@@ -24,58 +38,661 @@ void FmodAudioSystem::Update()
 {
     if (_studioSystem)
     {
-        // TODO: support multiple listeners.
-        // Update active listener
-        FmodAudioListener* activeListener = FmodAudio::ActiveListener;
-        if (activeListener)
+        // Finish the studio update started in the previous frame before touching the game state it reported.
+        WaitForStudioUpdate();
+
+        // Update enabled listeners
+        const auto& listeners = FmodAudio::Listeners;
+        const int32 listenerCount = Math::Min(listeners.Count(), FMOD_MAX_LISTENERS);
+        if (listenerCount > 0 && listenerCount != _listenerCount)
         {
-            FMOD_3D_ATTRIBUTES listenerAttributes;
-            Vector3 listenerPosition = activeListener->GetPosition();
-            Vector3 listenerVelocity = activeListener->GetVelocity();
-            Vector3 listenerForward = activeListener->GetDirection();
-            Vector3 listenerUp = activeListener->GetTransform().GetUp();
-            listenerAttributes.position = { static_cast<float>(listenerPosition.X), static_cast<float>(listenerPosition.Y), static_cast<float>(listenerPosition.Z) };
-            listenerAttributes.velocity = { static_cast<float>(listenerVelocity.X), static_cast<float>(listenerVelocity.Y), static_cast<float>(listenerVelocity.Z) };
-            listenerAttributes.forward = { static_cast<float>(listenerForward.X), static_cast<float>(listenerForward.Y), static_cast<float>(listenerForward.Z) };
-            listenerAttributes.up = { static_cast<float>(listenerUp.X), static_cast<float>(listenerUp.Y), static_cast<float>(listenerUp.Z) };
+            _studioSystem->setNumListeners(listenerCount);
+            _listenerCount = listenerCount;
 
-            _studioSystem->setListenerAttributes(0, &listenerAttributes);
+            // Send the weights again since listeners were added or removed.
+            for (float& weight : _listenerWeights)
+                weight = -1.0f;
+        }
+        for (int32 i = 0; i < listenerCount; i++)
+        {
+            const auto listener = listeners[i];
+            auto& transform = _listenerTransforms[i];
+            transform.Position = listener->GetPosition();
+            transform.Velocity = listener->GetVelocity();
+            transform.Forward = listener->GetDirection();
+            transform.Up = listener->GetTransform().GetUp();
         }
+        _listenerTransformCount = listenerCount;
 
-        // Update sources/events
-        auto sources = FmodAudio::Sources;
-        for (int i = 0; i < sources.Count(); ++i)
+        // With large worlds, positions are sent relative to the cell of the active listener so they keep their precision far from the world origin.
+        if (FmodAudio::ActiveListener)
+            UpdateAudioOrigin(FmodAudio::ActiveListener->GetPosition());
+        Fmod3DAttributes::Convert(_listenerTransforms, _listenerAttributes, listenerCount, _audioOrigin);
+        for (int32 i = 0; i < listenerCount; i++)
         {
-            const auto source = sources[i];
-            const auto eventInstance = source->EventInstance;
-            if (eventInstance == nullptr)
-                continue;
+            _studioSystem->setListenerAttributes(i, &_listenerAttributes[i]);
 
-            auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
-            if (!instance->isValid())
-                continue;
+            const float weight = listeners[i]->GetWeight();
+            if (weight != _listenerWeights[i])
+            {
+                _studioSystem->setListenerWeight(i, weight);
+                _listenerWeights[i] = weight;
+            }
+        }
 
-            if (!IsEvent3D(instance))
-                continue;
+        // Poll asynchronous bank loads and unloads and keep the sample data in the memory budget
+        UpdateBankLoads();
+        UpdateUnloadingBanks();
+        UpdateBankResidency();
+
+        // Return finished pooled one-shot sources
+        FmodAudio::UpdateOneShots();
+
+        // Create or release the instances of sources moving in and out of range
+        UpdateSourceVirtualization();
+
+        // Update sources/events that moved since the last update
+        UpdateSourceAttributes();
 
-            FMOD_3D_ATTRIBUTES sourceAttributes;
-            Vector3 sourcePosition = source->GetPosition();
-            Vector3 sourceVelocity = source->GetVelocity();
-            Vector3 sourceForward = source->GetDirection();
-            Vector3 sourceUp = source->GetTransform().GetUp();
-            sourceAttributes.position = { static_cast<float>(sourcePosition.X), static_cast<float>(sourcePosition.Y), static_cast<float>(sourcePosition.Z) };
-            sourceAttributes.velocity = { static_cast<float>(sourceVelocity.X), static_cast<float>(sourceVelocity.Y), static_cast<float>(sourceVelocity.Z) };
-            sourceAttributes.forward = { static_cast<float>(sourceForward.X), static_cast<float>(sourceForward.Y), static_cast<float>(sourceForward.Z) };
-            sourceAttributes.up = { static_cast<float>(sourceUp.X), static_cast<float>(sourceUp.Y), static_cast<float>(sourceUp.Z) };
-            instance->set3DAttributes(&sourceAttributes);
+        if (_updateStage == FmodUpdateStage::Job)
+        {
+            Function<void(int32)> job;
+            job.Bind<FmodAudioSystem, &FmodAudioSystem::UpdateStudioJob>(this);
+            _studioUpdateJob = JobSystem::Dispatch(job);
+            return;
         }
 
         const auto result = _studioSystem->update();
         if (result != FMOD_OK)
             FMODLOG(Warning, "Failed to update Fmod studio system. Error: {}", String(FMOD_ErrorString(result)));
+
+        // Fire the event callbacks queued by fmod's threads
+        DispatchEventCallbacks();
+    }
+}
+
+double FmodAudioSystem::GetTime() const
+{
+    // Manually stepped renders use the simulated clock so time based limits and eviction repeat between runs.
+    return _manualUpdate ? _manualTime : Platform::GetTimeSeconds();
+}
+
+void FmodAudioSystem::UpdateStudioJob(int32 index)
+{
+    const auto result = _studioSystem->update();
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to update Fmod studio system. Error: {}", String(FMOD_ErrorString(result)));
+}
+
+void FmodAudioSystem::WaitForStudioUpdate()
+{
+    if (_studioUpdateJob == 0)
+        return;
+    JobSystem::Wait(_studioUpdateJob);
+    _studioUpdateJob = 0;
+    DispatchEventCallbacks();
+}
+
+void FmodAudioSystem::UpdateSourceAttributes()
+{
+    auto& dirtySources = FmodAudio::DirtySources;
+    const int32 count = dirtySources.Count();
+    if (count == 0)
+        return;
+
+    // Gather into the buffer first, on the job system for many sources, and submit to fmod from this thread.
+    _sourceAttributes.Resize(count);
+    if (_settings->ParallelSourceUpdate && count >= _settings->ParallelSourceUpdateThreshold)
+    {
+        const int32 jobCount = (count + SourceAttributesChunkSize - 1) / SourceAttributesChunkSize;
+        Function<void(int32)> job;
+        job.Bind<FmodAudioSystem, &FmodAudioSystem::GatherSourceAttributesJob>(this);
+        JobSystem::Wait(JobSystem::Dispatch(job, jobCount));
+    }
+    else
+    {
+        GatherSourceAttributes(0, count);
+    }
+
+    for (int32 i = 0; i < count; i++)
+    {
+        const auto instance = _sourceAttributes.Instances[i];
+        if (instance)
+            instance->set3DAttributes(&_sourceAttributes.Attributes[i]);
+    }
+    dirtySources.Clear();
+}
+
+void FmodAudioSystem::GatherSourceAttributesJob(int32 chunkIndex)
+{
+    const int32 start = chunkIndex * SourceAttributesChunkSize;
+    GatherSourceAttributes(start, Math::Min(start + SourceAttributesChunkSize, _sourceAttributes.Instances.Count()));
+}
+
+void FmodAudioSystem::GatherSourceAttributes(int32 start, int32 end)
+{
+    // Only reads the sources and the instance slot map, and writes its own range of the buffer.
+    const auto& dirtySources = FmodAudio::DirtySources;
+    for (int32 i = start; i < end; i++)
+    {
+        const auto source = dirtySources[i];
+        source->_attributesDirty = false;
+        const auto instanceData = FindEventInstance(source->EventInstance);
+        if (!instanceData || !instanceData->Metadata->Is3D)
+        {
+            // Cleared so the batch conversion below never reads stale or uninitialized values.
+            _sourceAttributes.Instances[i] = nullptr;
+            Platform::MemoryClear(&_sourceAttributes.Transforms[i], sizeof(FmodTransform));
+            continue;
+        }
+
+        _sourceAttributes.Instances[i] = instanceData->Instance;
+        auto& transform = _sourceAttributes.Transforms[i];
+        transform.Position = source->GetPosition();
+        transform.Velocity = source->GetVelocity();
+        transform.Forward = source->GetDirection();
+        transform.Up = source->GetTransform().GetUp();
+    }
+
+    // Skipped sources are converted too as zeros, the batch is cheaper without branches.
+    Fmod3DAttributes::Convert(&_sourceAttributes.Transforms[start], &_sourceAttributes.Attributes[start], end - start, _audioOrigin);
+}
+
+void FmodAudioSystem::UpdateAudioOrigin(const Vector3& listenerPosition)
+{
+#if USE_LARGE_WORLDS
+    // Snap to the cell center so the origin only moves when the listener enters another cell.
+    const Real cellSize = _settings->AudioOriginCellSize;
+    Vector3 origin = Vector3::Zero;
+    if (cellSize > 0)
+    {
+        origin.X = Math::Round(listenerPosition.X / cellSize) * cellSize;
+        origin.Y = Math::Round(listenerPosition.Y / cellSize) * cellSize;
+        origin.Z = Math::Round(listenerPosition.Z / cellSize) * cellSize;
+    }
+    if (origin == _audioOrigin)
+        return;
+    _audioOrigin = origin;
+
+    // Every source position is relative to the origin, so all of them have to be sent again.
+    for (const auto source : FmodAudio::Sources)
+        source->MarkAttributesDirty();
+
+    // One-shots without a source keep the world position they were played at.
+    FMOD_3D_ATTRIBUTES attributes;
+    for (const auto& instanceData : _eventInstances)
+    {
+        if (instanceData.Source || !instanceData.Metadata->Is3D)
+            continue;
+        GetOneShotAttributes(instanceData.Position, _audioOrigin, attributes);
+        instanceData.Instance->set3DAttributes(&attributes);
+    }
+#endif
+}
+
+void FmodAudioSystem::UpdateSourceVirtualization()
+{
+    const bool enabled = _settings->VirtualizeDistantSources;
+    if ((!enabled && !_hasVirtualSources) || _listenerTransformCount == 0)
+        return;
+
+    // Realize all virtual sources when virtualization gets disabled.
+    const Real margin = _settings->VirtualizationMargin;
+    _hasVirtualSources = false;
+    for (const auto source : FmodAudio::Sources)
+    {
+        if (source->_virtual)
+        {
+            const Real maxDistance = (source->_overrideDistance ? source->_maxDistance : source->_virtualMaxDistance) + margin;
+            if (!enabled || GetListenerDistanceSquared(source->GetPosition()) <= maxDistance * maxDistance)
+            {
+                source->_virtual = false;
+                source->CreateInstance();
+            }
+            else
+            {
+                _hasVirtualSources = true;
+            }
+        }
+        else if (enabled && source->EventInstance)
+        {
+            const auto instanceData = FindEventInstance(source->EventInstance);
+            if (!instanceData || !instanceData->Metadata->Is3D)
+                continue;
+            const Real maxDistance = instanceData->MaxDistance + margin * 2;
+            if (GetListenerDistanceSquared(source->GetPosition()) > maxDistance * maxDistance)
+            {
+                VirtualizeSource(source, instanceData->Metadata);
+                _hasVirtualSources = true;
+            }
+        }
     }
 }
 
+void FmodAudioSystem::VirtualizeSource(FmodAudioSource* source, const FmodEventMetadata* metadata)
+{
+    // Keep looping events playing once the source comes back in range.
+    bool playing = false;
+    const auto instance = GetEventInstance(source->EventInstance);
+    if (!metadata->IsOneshot)
+    {
+        if (instance)
+        {
+            bool paused = false;
+            FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
+            instance->getPaused(&paused);
+            instance->getPlaybackState(&state);
+            playing = !paused && (state == FMOD_STUDIO_PLAYBACK_PLAYING || state == FMOD_STUDIO_PLAYBACK_STARTING || state == FMOD_STUDIO_PLAYBACK_SUSTAINING);
+        }
+    }
+
+    // Parameters set on the instance are applied again to the next one.
+    if (instance)
+    {
+        for (const auto& parameter : metadata->Parameters)
+        {
+            float value;
+            if ((parameter.flags & (FMOD_STUDIO_PARAMETER_READONLY | FMOD_STUDIO_PARAMETER_AUTOMATIC | FMOD_STUDIO_PARAMETER_GLOBAL)) == 0 &&
+                instance->getParameterByID(parameter.id, &value) == FMOD_OK && value != parameter.defaultvalue)
+                source->SetPendingParameter(String::Empty, FmodParameterId(parameter.id), value);
+        }
+    }
+
+    ReleaseEventInstance(source->EventInstance);
+    source->EventInstance = FmodEventHandle();
+    source->_playPending = playing || source->_playPending;
+    source->_virtual = true;
+    source->_virtualOneshot = metadata->IsOneshot;
+    source->_virtualMaxDistance = metadata->MaxDistance;
+}
+
+Real FmodAudioSystem::GetListenerDistanceSquared(const Vector3& position) const
+{
+    Real result = MAX_Real;
+    if (_listenerTransformCount == 0)
+    {
+        // The listener cache is only filled by the first update, sources created with the level read the listeners directly.
+        const int32 listenerCount = Math::Min(FmodAudio::Listeners.Count(), FMOD_MAX_LISTENERS);
+        for (int32 i = 0; i < listenerCount; i++)
+            result = Math::Min(result, Vector3::DistanceSquared(position, FmodAudio::Listeners[i]->GetPosition()));
+        return result;
+    }
+    for (int32 i = 0; i < _listenerTransformCount; i++)
+        result = Math::Min(result, Vector3::DistanceSquared(position, _listenerTransforms[i].Position));
+    return result;
+}
+
+static_assert(static_cast<uint32>(FmodStudioInitFlags::SynchronousUpdate) == FMOD_STUDIO_INIT_SYNCHRONOUS_UPDATE, "FmodStudioInitFlags must match FMOD_STUDIO_INITFLAGS.");
+static_assert(static_cast<uint32>(FmodStudioInitFlags::MemoryTracking) == FMOD_STUDIO_INIT_MEMORY_TRACKING, "FmodStudioInitFlags must match FMOD_STUDIO_INITFLAGS.");
+static_assert(static_cast<uint32>(FmodCoreInitFlags::Vol0BecomesVirtual) == FMOD_INIT_VOL0_BECOMES_VIRTUAL, "FmodCoreInitFlags must match FMOD_INITFLAGS.");
+static_assert(static_cast<uint32>(FmodCoreInitFlags::ThreadUnsafe) == FMOD_INIT_THREAD_UNSAFE, "FmodCoreInitFlags must match FMOD_INITFLAGS.");
+static_assert(static_cast<int32>(FmodSpeakerMode::SevenPointOnePointFour) == FMOD_SPEAKERMODE_7POINT1POINT4, "FmodSpeakerMode must match FMOD_SPEAKERMODE.");
+
+static Guid ToGuid(const FMOD_GUID& fmodGuid)
+{
+    static_assert(sizeof(Guid) == sizeof(FMOD_GUID), "Guid and FMOD_GUID must match in size.");
+    Guid result;
+    Platform::MemoryCopy(&result, &fmodGuid, sizeof(Guid));
+    return result;
+}
+
+FmodEventHandle FmodAudioSystem::AddEventInstance(FMOD::Studio::EventInstance* eventInstance, const FmodEventMetadata* metadata, FmodAudioSource* source)
+{
+    uint16 index;
+    if (_freeEventSlots.HasItems())
+    {
+        index = _freeEventSlots.Last();
+        _freeEventSlots.RemoveLast();
+    }
+    else
+    {
+        if (_eventSlots.Count() > MAX_uint16)
+        {
+            FMODLOG(Warning, "Failed to add event instance, the instance limit is reached.");
+            eventInstance->release();
+            return FmodEventHandle();
+        }
+        index = static_cast<uint16>(_eventSlots.Count());
+        _eventSlots.AddOne();
+    }
+
+    auto& slot = _eventSlots[index];
+    slot.DenseIndex = _eventInstances.Count();
+    auto& instanceData = _eventInstances.AddOne();
+    instanceData.Instance = eventInstance;
+    instanceData.Handle = FmodEventHandle(index, slot.Generation);
+    instanceData.Source = source;
+    instanceData.Metadata = metadata;
+    instanceData.MinDistance = metadata->MinDistance;
+    instanceData.MaxDistance = metadata->MaxDistance;
+    instanceData.Limited = false;
+    instanceData.Pooled = false;
+    instanceData.Position = Vector3::Zero;
+
+    // The handle is used by the callbacks to find the owning source.
+    eventInstance->setUserData(reinterpret_cast<void*>(static_cast<uintptr>(instanceData.Handle.Value)));
+    TouchBank(metadata);
+    return instanceData.Handle;
+}
+
+void FmodAudioSystem::RemoveEventInstance(FmodEventHandle eventInstance)
+{
+    if (!FindEventInstance(eventInstance))
+        return;
+
+    // Swap the last instance into the removed one to keep the storage dense.
+    auto& slot = _eventSlots[eventInstance.GetIndex()];
+    const int32 lastIndex = _eventInstances.Count() - 1;
+    if (slot.DenseIndex != lastIndex)
+    {
+        _eventInstances[slot.DenseIndex] = _eventInstances[lastIndex];
+        _eventSlots[_eventInstances[slot.DenseIndex].Handle.GetIndex()].DenseIndex = slot.DenseIndex;
+    }
+    _eventInstances.RemoveLast();
+
+    // Bump the generation so old handles are detected. Zero is skipped to keep handles non-zero.
+    slot.DenseIndex = -1;
+    slot.Generation = slot.Generation == MAX_uint16 ? 1 : slot.Generation + 1;
+    _freeEventSlots.Add(eventInstance.GetIndex());
+}
+
+FmodEventInstanceData* FmodAudioSystem::FindEventInstance(FmodEventHandle eventInstance)
+{
+    const uint16 index = eventInstance.GetIndex();
+    if (!eventInstance || index >= _eventSlots.Count())
+        return nullptr;
+    const auto& slot = _eventSlots[index];
+    if (slot.Generation != eventInstance.GetGeneration() || slot.DenseIndex < 0)
+        return nullptr;
+    return &_eventInstances[slot.DenseIndex];
+}
+
+FMOD::Studio::EventInstance* FmodAudioSystem::GetEventInstance(FmodEventHandle eventInstance)
+{
+    const auto instanceData = FindEventInstance(eventInstance);
+    return instanceData ? instanceData->Instance : nullptr;
+}
+
+FmodEventMetadata* FmodAudioSystem::AddEventMetadata(FMOD::Studio::EventDescription* eventDescription, FMOD::Studio::Bank* bank)
+{
+    FMOD_GUID fmodId;
+    if (eventDescription->getID(&fmodId) != FMOD_OK)
+        return nullptr;
+    const Guid id = ToGuid(fmodId);
+    FmodEventMetadata* metadata = nullptr;
+    if (_eventMetadata.TryGet(id, metadata))
+    {
+        // Entries resolved on demand get their bank once it finishes loading, and their path once the strings bank is loaded.
+        if (!metadata->Bank)
+            metadata->Bank = bank;
+        if (metadata->Path.IsEmpty())
+            RegisterEventPath(metadata);
+        return metadata;
+    }
+
+    metadata = New<FmodEventMetadata>();
+    metadata->Description = eventDescription;
+    metadata->Bank = bank;
+    eventDescription->is3D(&metadata->Is3D);
+    eventDescription->isOneshot(&metadata->IsOneshot);
+    int length = -1;
+    eventDescription->getLength(&length);
+    metadata->Length = static_cast<float>(length) * 0.001f;
+    eventDescription->getMinMaxDistance(&metadata->MinDistance, &metadata->MaxDistance);
+
+    int parameterCount = 0;
+    eventDescription->getParameterDescriptionCount(&parameterCount);
+    metadata->Parameters.Resize(parameterCount);
+    for (int i = 0; i < parameterCount; i++)
+    {
+        auto& parameter = metadata->Parameters[i];
+        eventDescription->getParameterDescriptionByIndex(i, &parameter);
+        metadata->ParameterIds[String(parameter.name)] = FmodParameterId(parameter.id);
+    }
+
+    RegisterEventPath(metadata);
+    _eventMetadata.Add(id, metadata);
+
+    // Pools of events used before are filled again when their bank loads.
+    int32 warmCount = 0;
+    if (_eventWarmCounts.TryGet(id, warmCount))
+    {
+        metadata->WarmCount = warmCount;
+        FillEventPool(metadata);
+    }
+    return metadata;
+}
+
+void FmodAudioSystem::RegisterEventPath(FmodEventMetadata* metadata)
+{
+    // Path is only available when the strings bank is loaded.
+    char path[512];
+    int retrieved = 0;
+    if (metadata->Description->getPath(path, ARRAY_COUNT(path), &retrieved) != FMOD_OK)
+        return;
+    metadata->Path = String(path);
+    metadata->PathHash = GetHash(metadata->Path);
+    _eventMetadataByPath[metadata->PathHash] = metadata;
+}
+
+void FmodAudioSystem::ReleaseEventMetadata(FmodEventMetadata* metadata)
+{
+    // Instances are invalidated by fmod together with the bank, but are stopped here so none keep playing without a slot.
+    for (int32 i = _eventInstances.Count() - 1; i >= 0; i--)
+    {
+        const auto& instanceData = _eventInstances[i];
+        if (instanceData.Metadata != metadata)
+            continue;
+        const auto instance = instanceData.Instance;
+        const bool owned = instanceData.Source || instanceData.Pooled;
+        RemoveEventInstance(instanceData.Handle);
+        instance->setCallback(nullptr, 0);
+        instance->setUserData(nullptr);
+        instance->stop(FMOD_STUDIO_STOP_IMMEDIATE);
+
+        // Other one-shots were released when they started.
+        if (owned)
+            instance->release();
+    }
+    for (const auto instance : metadata->Pool)
+        instance->release();
+    metadata->Pool.Clear();
+
+    FmodEventMetadata* pathMetadata = nullptr;
+    if (_eventMetadataByPath.TryGet(metadata->PathHash, pathMetadata) && pathMetadata == metadata)
+        _eventMetadataByPath.Remove(metadata->PathHash);
+    Delete(metadata);
+}
+
+FMOD::Studio::EventInstance* FmodAudioSystem::AcquireEventInstance(const FmodEventMetadata* metadata)
+{
+    if (metadata->Pool.HasItems())
+        return metadata->Pool.Pop();
+
+    FMOD::Studio::EventInstance* eventInstance = nullptr;
+    const auto result = metadata->Description->createInstance(&eventInstance);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to create event instance at {}, Error: {}", metadata->Path, String(FMOD_ErrorString(result)));
+        return nullptr;
+    }
+    return eventInstance;
+}
+
+bool FmodAudioSystem::ReturnEventInstance(FMOD::Studio::EventInstance* eventInstance, const FmodEventMetadata* metadata)
+{
+    if (metadata->Pool.Count() >= metadata->WarmCount)
+        return false;
+
+    // Reset everything the integration may have changed so the next user gets a fresh instance.
+    eventInstance->setCallback(nullptr, 0);
+    eventInstance->setUserData(nullptr);
+    eventInstance->setPaused(false);
+    eventInstance->setVolume(1.0f);
+    eventInstance->setPitch(1.0f);
+    eventInstance->setTimelinePosition(0);
+    eventInstance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MINIMUM_DISTANCE, -1.0f);
+    eventInstance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MAXIMUM_DISTANCE, -1.0f);
+    for (const auto& parameter : metadata->Parameters)
+    {
+        if ((parameter.flags & (FMOD_STUDIO_PARAMETER_READONLY | FMOD_STUDIO_PARAMETER_AUTOMATIC | FMOD_STUDIO_PARAMETER_GLOBAL)) == 0)
+            eventInstance->setParameterByID(parameter.id, parameter.defaultvalue, true);
+    }
+    metadata->Pool.Add(eventInstance);
+    return true;
+}
+
+void FmodAudioSystem::FillEventPool(const FmodEventMetadata* metadata)
+{
+    while (metadata->Pool.Count() < metadata->WarmCount)
+    {
+        FMOD::Studio::EventInstance* eventInstance = nullptr;
+        if (metadata->Description->createInstance(&eventInstance) != FMOD_OK)
+            break;
+        metadata->Pool.Add(eventInstance);
+    }
+}
+
+void FmodAudioSystem::WarmEventInstances(const FmodEvent* event)
+{
+    if (event->WarmInstances <= 0)
+        return;
+    const auto metadata = event->Guid.HasChars() ? GetEventMetadata(event->GetFmodGuid()) : GetEventMetadata(event->Path);
+    if (metadata)
+        WarmEventInstances(event, metadata);
+}
+
+void FmodAudioSystem::WarmEventInstances(const FmodEvent* event, const FmodEventMetadata* metadata)
+{
+    if (event->WarmInstances <= 0 || metadata->WarmCount == event->WarmInstances)
+        return;
+
+    // Remembered by id so the pool is filled again when the bank is reloaded.
+    FMOD_GUID fmodId;
+    if (metadata->Description->getID(&fmodId) == FMOD_OK)
+        _eventWarmCounts[ToGuid(fmodId)] = event->WarmInstances;
+    metadata->WarmCount = event->WarmInstances;
+    FillEventPool(metadata);
+}
+
+void FmodAudioSystem::AddBankMetadata(FMOD::Studio::Bank* bank)
+{
+    AddBankMixerHandles(bank);
+
+    // Events cached before the strings bank was loaded, like the ones of the master bank, get their path now.
+    int stringCount = 0;
+    if (bank->getStringCount(&stringCount) == FMOD_OK && stringCount > 0)
+    {
+        for (auto& metadata : _eventMetadata)
+        {
+            if (metadata.Value->Path.IsEmpty())
+                RegisterEventPath(metadata.Value);
+        }
+    }
+
+    int eventCount = 0;
+    bank->getEventCount(&eventCount);
+    if (eventCount <= 0)
+        return;
+
+    Array<FMOD::Studio::EventDescription*> eventDescriptions;
+    eventDescriptions.Resize(eventCount);
+    bank->getEventList(eventDescriptions.Get(), eventCount, &eventCount);
+    for (int i = 0; i < eventCount; i++)
+        AddEventMetadata(eventDescriptions[i], bank);
+}
+
+void FmodAudioSystem::AddBankMixerHandles(FMOD::Studio::Bank* bank)
+{
+    // Assets holding handles resolve them again since the new bank may add buses and VCAs.
+    _mixerEpoch++;
+
+    char path[512];
+    int busCount = 0;
+    bank->getBusCount(&busCount);
+    if (busCount > 0)
+    {
+        Array<FMOD::Studio::Bus*> buses;
+        buses.Resize(busCount);
+        bank->getBusList(buses.Get(), busCount, &busCount);
+        for (int i = 0; i < busCount; i++)
+        {
+            FMOD_GUID fmodId;
+            if (buses[i]->getID(&fmodId) == FMOD_OK)
+                _buses[ToGuid(fmodId)] = buses[i];
+            if (buses[i]->getPath(path, sizeof(path), nullptr) == FMOD_OK)
+                _busesByPath[String(path)] = buses[i];
+        }
+    }
+
+    int vcaCount = 0;
+    bank->getVCACount(&vcaCount);
+    if (vcaCount > 0)
+    {
+        Array<FMOD::Studio::VCA*> vcas;
+        vcas.Resize(vcaCount);
+        bank->getVCAList(vcas.Get(), vcaCount, &vcaCount);
+        for (int i = 0; i < vcaCount; i++)
+        {
+            FMOD_GUID fmodId;
+            if (vcas[i]->getID(&fmodId) == FMOD_OK)
+                _vcas[ToGuid(fmodId)] = vcas[i];
+            if (vcas[i]->getPath(path, sizeof(path), nullptr) == FMOD_OK)
+                _vcasByPath[String(path)] = vcas[i];
+        }
+    }
+}
+
+void FmodAudioSystem::ReleaseMixerHandles()
+{
+    // Buses and VCAs can be shared between banks so all of them are resolved again on demand.
+    _mixerEpoch++;
+    _buses.Clear();
+    _busesByPath.Clear();
+    _vcas.Clear();
+    _vcasByPath.Clear();
+}
+
+void FmodAudioSystem::ReleaseBankMetadata(FMOD::Studio::Bank* bank)
+{
+    ReleaseMixerHandles();
+    _globalParameterIds.Clear();
+
+    // Only the events of this bank are released. Metadata resolved on demand before the bank was cached has no bank set yet.
+    int eventCount = 0;
+    bank->getEventCount(&eventCount);
+    if (eventCount <= 0)
+        return;
+
+    Array<FMOD::Studio::EventDescription*> eventDescriptions;
+    eventDescriptions.Resize(eventCount);
+    bank->getEventList(eventDescriptions.Get(), eventCount, &eventCount);
+    for (int i = 0; i < eventCount; i++)
+    {
+        FMOD_GUID fmodId;
+        if (eventDescriptions[i]->getID(&fmodId) != FMOD_OK)
+            continue;
+        const Guid id = ToGuid(fmodId);
+        FmodEventMetadata* metadata = nullptr;
+        if (!_eventMetadata.TryGet(id, metadata) || (metadata->Bank != bank && metadata->Bank != nullptr))
+            continue;
+        _eventMetadata.Remove(id);
+        ReleaseEventMetadata(metadata);
+    }
+}
+
+void FmodAudioSystem::ReleaseAllMetadata()
+{
+    ReleaseMixerHandles();
+    _globalParameterIds.Clear();
+    while (_eventInstances.HasItems())
+        RemoveEventInstance(_eventInstances.Last().Handle);
+    _eventMetadataByPath.Clear();
+    for (auto& metadata : _eventMetadata)
+        Delete(metadata.Value);
+    _eventMetadata.Clear();
+}
+
 FMOD_RESULT FmodAudioSystem::OnSystemCallback(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type, void* commanddata1, void* commanddata2, void* userdata)
 {
     auto* audioSystem = static_cast<FmodAudioSystem*>(userdata);
@@ -105,50 +722,111 @@ FMOD_RESULT FmodAudioSystem::OnEventInstanceCallback(FMOD_STUDIO_EVENT_CALLBACK_
     if (!eventInstance)
         return FMOD_OK;
 
-    auto source = EventMap[eventInstance];
-    if (!source)
+    // Only instances created through the audio system dispatch callbacks.
+    void* userData = nullptr;
+    if (eventInstance->getUserData(&userData) != FMOD_OK || !userData)
         return FMOD_OK;
 
-    if (type == FMOD_STUDIO_EVENT_CALLBACK_STARTING)
-    {
-        source->EventStarting();
-    }
-    else if (type == FMOD_STUDIO_EVENT_CALLBACK_STARTED)
-    {
-        source->EventStarted();
-    }
-    else if (type == FMOD_STUDIO_EVENT_CALLBACK_STOPPED)
-    {
-        source->EventStopped();
-    }
-    else if (type == FMOD_STUDIO_EVENT_CALLBACK_RESTARTED)
-    {
-        source->EventRestarted();
-    }
-    else if (type == FMOD_STUDIO_EVENT_CALLBACK_START_EVENT_COMMAND)
-    {
-        source->SubEventStarted();
-    }
-    else if (type == FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER)
+    // Called from fmod's threads. Only copy the data here, it is dispatched on the game thread in Update.
+    FmodEventCallbackRecord record = {};
+    record.Instance = eventInstance;
+    record.Handle.Value = static_cast<uint32>(reinterpret_cast<uintptr>(userData));
+    record.Type = type;
+    if (type == FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER)
     {
         FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES* markerProperties = (FMOD_STUDIO_TIMELINE_MARKER_PROPERTIES*)parameters;
-        source->TimelineMarker(String(markerProperties->name), markerProperties->position);
+        record.Values[0] = EventCallbacks.InternMarkerName(markerProperties->name);
+        record.Values[1] = markerProperties->position;
     }
     else if (type == FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT)
     {
         FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES* beatProperties = (FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES*)parameters;
-        source->TimelineBeat(beatProperties->beat, beatProperties->bar, beatProperties->tempo, beatProperties->position);
+        record.Values[0] = beatProperties->beat;
+        record.Values[1] = beatProperties->bar;
+        record.Values[2] = beatProperties->position;
+        record.Tempo = beatProperties->tempo;
     }
     else if (type == FMOD_STUDIO_EVENT_CALLBACK_NESTED_TIMELINE_BEAT)
     {
         FMOD_STUDIO_TIMELINE_NESTED_BEAT_PROPERTIES* nestedProperties = (FMOD_STUDIO_TIMELINE_NESTED_BEAT_PROPERTIES*)parameters;
         FMOD_STUDIO_TIMELINE_BEAT_PROPERTIES beatProperties = nestedProperties->properties;
-        source->SubTimelineBeat(beatProperties.beat, beatProperties.bar, beatProperties.tempo, beatProperties.position);
+        record.Values[0] = beatProperties.beat;
+        record.Values[1] = beatProperties.bar;
+        record.Values[2] = beatProperties.position;
+        record.Tempo = beatProperties.tempo;
     }
+    EventCallbacks.Enqueue(record);
 
     return FMOD_OK;
 }
 
+void FmodAudioSystem::DispatchEventCallbacks()
+{
+    const int64 droppedCount = EventCallbacks.PopDroppedCount();
+    if (droppedCount > 0)
+        FMODLOG(Warning, "Dropped {} event callbacks, the callback queue is full.", droppedCount);
+
+    FmodEventCallbackRecord record;
+    while (EventCallbacks.Dequeue(record))
+    {
+        // Instances released since the callback was queued have a stale handle.
+        const auto instanceData = FindEventInstance(record.Handle);
+        if (!instanceData || instanceData->Instance != record.Instance)
+            continue;
+        if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_STOPPED)
+            instanceData->Limited = false;
+
+        // One-shots without a source are only tracked for the event limits and pools until they stop.
+        auto source = instanceData->Source;
+        if (!source)
+        {
+            if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_STOPPED)
+            {
+                const auto instance = instanceData->Instance;
+                const auto metadata = instanceData->Metadata;
+                const bool pooled = instanceData->Pooled;
+                RemoveEventInstance(record.Handle);
+                if (pooled && !ReturnEventInstance(instance, metadata))
+                    instance->release();
+            }
+            continue;
+        }
+
+        if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_STARTING)
+        {
+            source->EventStarting();
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_STARTED)
+        {
+            source->EventStarted();
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_STOPPED)
+        {
+            source->EventStopped();
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_RESTARTED)
+        {
+            source->EventRestarted();
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_START_EVENT_COMMAND)
+        {
+            source->SubEventStarted();
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER)
+        {
+            source->TimelineMarker(EventCallbacks.GetMarkerName(record.Values[0]), record.Values[1]);
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT)
+        {
+            source->TimelineBeat(record.Values[0], record.Values[1], record.Tempo, record.Values[2]);
+        }
+        else if (record.Type == FMOD_STUDIO_EVENT_CALLBACK_NESTED_TIMELINE_BEAT)
+        {
+            source->SubTimelineBeat(record.Values[0], record.Values[1], record.Tempo, record.Values[2]);
+        }
+    }
+}
+
 void FmodAudioSystem::Initialize()
 {
     auto result = FMOD::Studio::System::create(&_studioSystem);
@@ -159,25 +837,99 @@ void FmodAudioSystem::Initialize()
     }
 
     _settings = FmodAudioSettings::Get();
+    const auto& initSettings = _settings->GetInitSettings();
+
+    result = _studioSystem->getCoreSystem(&_coreSystem);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to get Fmod core system. Error: {}", String(FMOD_ErrorString(result)));
+        return;
+    }
+
+    // The output and mixer format can only be changed before the system is initialized.
+    if (initSettings.OutputType != FmodOutputType::Auto)
+    {
+        FMOD_OUTPUTTYPE outputType;
+        switch (initSettings.OutputType)
+        {
+        case FmodOutputType::NoSound:
+            outputType = FMOD_OUTPUTTYPE_NOSOUND;
+            break;
+        case FmodOutputType::NoSoundNrt:
+            outputType = FMOD_OUTPUTTYPE_NOSOUND_NRT;
+            break;
+        default:
+            outputType = FMOD_OUTPUTTYPE_WAVWRITER_NRT;
+            break;
+        }
+        result = _coreSystem->setOutput(outputType);
+        if (result != FMOD_OK)
+            FMODLOG(Warning, "Failed to set Fmod output type. Error: {}", String(FMOD_ErrorString(result)));
+    }
+    if (initSettings.RandomSeed != 0)
+    {
+        FMOD_ADVANCEDSETTINGS advancedSettings = {};
+        advancedSettings.cbSize = sizeof(FMOD_ADVANCEDSETTINGS);
+        _coreSystem->getAdvancedSettings(&advancedSettings);
+        advancedSettings.randomSeed = initSettings.RandomSeed;
+        result = _coreSystem->setAdvancedSettings(&advancedSettings);
+        if (result != FMOD_OK)
+            FMODLOG(Warning, "Failed to set Fmod random seed. Error: {}", String(FMOD_ErrorString(result)));
+    }
+    result = _coreSystem->setSoftwareChannels(initSettings.SoftwareChannels);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to set Fmod software channels. Error: {}", String(FMOD_ErrorString(result)));
+    if (initSettings.SampleRate > 0 || initSettings.SpeakerMode != FmodSpeakerMode::Default)
+    {
+        int sampleRate = 0, rawSpeakers = 0;
+        FMOD_SPEAKERMODE speakerMode = FMOD_SPEAKERMODE_DEFAULT;
+        _coreSystem->getSoftwareFormat(&sampleRate, &speakerMode, &rawSpeakers);
+        if (initSettings.SampleRate > 0)
+            sampleRate = initSettings.SampleRate;
+        if (initSettings.SpeakerMode != FmodSpeakerMode::Default)
+            speakerMode = static_cast<FMOD_SPEAKERMODE>(initSettings.SpeakerMode);
+        result = _coreSystem->setSoftwareFormat(sampleRate, speakerMode, rawSpeakers);
+        if (result != FMOD_OK)
+            FMODLOG(Warning, "Failed to set Fmod software format. Error: {}", String(FMOD_ErrorString(result)));
+    }
+    if (initSettings.DspBufferLength > 0 || initSettings.DspBufferCount > 0)
+    {
+        unsigned int bufferLength = 0;
+        int bufferCount = 0;
+        _coreSystem->getDSPBufferSize(&bufferLength, &bufferCount);
+        if (initSettings.DspBufferLength > 0)
+            bufferLength = initSettings.DspBufferLength;
+        if (initSettings.DspBufferCount > 0)
+            bufferCount = initSettings.DspBufferCount;
+        result = _coreSystem->setDSPBufferSize(bufferLength, bufferCount);
+        if (result != FMOD_OK)
+            FMODLOG(Warning, "Failed to set Fmod DSP buffer size. Error: {}", String(FMOD_ErrorString(result)));
+    }
 
-    // TODO: make parameters into settings
-    result = _studioSystem->initialize(_settings->MaxChannels, FMOD_STUDIO_INIT_NORMAL, FMOD_INIT_NORMAL, nullptr);
-    if (result != FMOD_OK)
+    // Offline renders are stepped by FmodCapture on a simulated clock. The studio commands are run on the calling thread so the mix only depends on the steps.
+    _manualUpdate = initSettings.OutputType == FmodOutputType::WavWriterNrt;
+    _manualTime = 0.0;
+    auto studioFlags = initSettings.StudioFlags;
+    StringAnsi wavWriterPath;
+    void* extraDriverData = nullptr;
+    if (_manualUpdate)
     {
-        FMODLOG(Warning, "Failed to initialize Fmod studio system. Error: {}", String(FMOD_ErrorString(result)));
-        return;
+        studioFlags |= FmodStudioInitFlags::SynchronousUpdate;
+        if (initSettings.WavWriterPath.HasChars())
+        {
+            wavWriterPath = (Globals::ProjectFolder + TEXT("/") + initSettings.WavWriterPath).ToStringAnsi();
+            extraDriverData = (void*)wavWriterPath.Get();
+        }
     }
 
-    result = _studioSystem->getCoreSystem(&_coreSystem);
+    result = _studioSystem->initialize(_settings->MaxChannels, static_cast<FMOD_STUDIO_INITFLAGS>(studioFlags), static_cast<FMOD_INITFLAGS>(initSettings.CoreFlags), extraDriverData);
     if (result != FMOD_OK)
     {
-        FMODLOG(Warning, "Failed to get Fmod core system. Error: {}", String(FMOD_ErrorString(result)));
+        FMODLOG(Warning, "Failed to initialize Fmod studio system. Error: {}", String(FMOD_ErrorString(result)));
         return;
     }
 
-    // TODO: expose doppler scale and rolloff scale to settings
-    // Distance factor is 0.01f for centimeters. 1 = 1 meter.
-    _coreSystem->set3DSettings(1, 0.01f, 1);
+    _coreSystem->set3DSettings(initSettings.DopplerScale, initSettings.DistanceFactor, initSettings.RolloffScale);
 
     _coreSystem->setUserData(this); // To use in events
     _coreSystem->setCallback(&OnSystemCallback, FMOD_SYSTEM_CALLBACK_DEVICELISTCHANGED | FMOD_SYSTEM_CALLBACK_DEVICELOST);
@@ -191,7 +943,23 @@ void FmodAudioSystem::Initialize()
     auto activeAudioDevice = FmodAudio::AudioDevices[FmodAudio::GetActiveAudioDevice()];
     FMODLOG(Info, "Active audio device: {}.", activeAudioDevice.Name);
 
-    Scripting::Update.Bind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
+    // The studio update runs in parallel with fmod calls from the game thread, which needs the thread safe core.
+    _updateStage = _settings->UpdateStage;
+    if (_updateStage == FmodUpdateStage::Job && EnumHasAnyFlags(initSettings.CoreFlags, FmodCoreInitFlags::ThreadUnsafe))
+    {
+        FMODLOG(Warning, "The Job update stage cannot be used with the ThreadUnsafe core init flag. Updating with the scripts update instead.");
+        _updateStage = FmodUpdateStage::Update;
+    }
+    if (_manualUpdate)
+        _updateStage = FmodUpdateStage::Update;
+    else if (_updateStage == FmodUpdateStage::LateUpdate)
+        Scripting::LateUpdate.Bind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
+    else
+        Scripting::Update.Bind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
+
+    // Without synchronous updates fmod's studio thread does the processing, and the stage only moves when the commands are flushed.
+    if (_updateStage != FmodUpdateStage::Update && !EnumHasAnyFlags(studioFlags, FmodStudioInitFlags::SynchronousUpdate))
+        FMODLOG(Info, "The {} update stage is used without the SynchronousUpdate studio init flag, so it only changes when the commands are sent to fmod's studio thread.", _updateStage == FmodUpdateStage::Job ? TEXT("Job") : TEXT("LateUpdate"));
 
     // Load plugins if any.
 #if USE_EDITOR
@@ -272,7 +1040,10 @@ void FmodAudioSystem::Initialize()
         {
             if (StringUtils::GetFileName(bankFile).Compare(masterBankFileName) == 0 || StringUtils::GetFileName(bankFile).Compare(masterBankStringsFileName) == 0)
                 continue;
-            LoadBank(bankFile, FMOD_STUDIO_LOAD_BANK_NORMAL, _settings->PreloadBankSampleData);
+            if (_settings->LoadBanksAsync)
+                LoadBankAsync(StringView(bankFile), _settings->PreloadBankSampleData);
+            else
+                LoadBank(bankFile, FMOD_STUDIO_LOAD_BANK_NORMAL, _settings->PreloadBankSampleData);
         }
     }
     // Load specifically defined banks
@@ -294,7 +1065,10 @@ void FmodAudioSystem::Initialize()
             {
                 if (StringUtils::GetFileName(bankFile).Compare(preloadFileName) == 0)
                 {
-                    LoadBank(bankFile, FMOD_STUDIO_LOAD_BANK_NORMAL, _settings->PreloadBankSampleData);
+                    if (_settings->LoadBanksAsync)
+                        LoadBankAsync(StringView(bankFile), _settings->PreloadBankSampleData);
+                    else
+                        LoadBank(bankFile, FMOD_STUDIO_LOAD_BANK_NORMAL, _settings->PreloadBankSampleData);
                     break;
                 }
             }
@@ -304,12 +1078,22 @@ void FmodAudioSystem::Initialize()
 
 void FmodAudioSystem::Deinitialize()
 {
+    if (_manualUpdate)
+        _manualUpdate = false;
+    else if (_updateStage == FmodUpdateStage::LateUpdate)
+        Scripting::LateUpdate.Unbind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
+    else
+        Scripting::Update.Unbind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
+    if (_studioUpdateJob != 0)
+    {
+        JobSystem::Wait(_studioUpdateJob);
+        _studioUpdateJob = 0;
+    }
+
     FmodAudio::Deinitialize();
 
     UnloadAllBanks();
 
-    Scripting::Update.Unbind<FmodAudioSystem, &FmodAudioSystem::Update>(this);
-
     for (auto pluginHandle : _loadedPlugins)
     {
         _coreSystem->unloadPlugin(pluginHandle);
@@ -323,6 +1107,15 @@ void FmodAudioSystem::Deinitialize()
         _studioSystem = nullptr;
     }
 
+    // All banks are unloaded once the studio system is released.
+    for (auto residency : _unloadingBanks)
+    {
+        if (residency->FileData)
+            Delete(residency->FileData);
+        Delete(residency);
+    }
+    _unloadingBanks.Clear();
+
     _settings = nullptr;
 }
 
@@ -423,23 +1216,245 @@ float FmodAudioSystem::GetMasterPitch()
 
 void FmodAudioSystem::LoadBank(const StringView& bankPath, int loadFlags, bool loadSampleData)
 {
-    if (IsBankLoaded(bankPath))
+    FmodBankResidency* residency = nullptr;
+    if (_loadedBanks.TryGet(bankPath, residency))
+    {
+        // Block on a pending asynchronous load since the caller expects the bank to be usable.
+        FmodBankLoadHandle* handle = nullptr;
+        if (_bankLoadHandles.TryGet(bankPath, handle) && !handle->IsDone())
+            _studioSystem->flushCommands();
+
+        residency->MetadataRefs++;
+        if (loadSampleData)
+            AddLoadSampleDataRef(residency);
         return;
+    }
 
     FMOD::Studio::Bank* bank = nullptr;
-    auto result = _studioSystem->loadBankFile(bankPath.ToStringAnsi().GetText(), static_cast<FMOD_STUDIO_LOAD_BANK_FLAGS>(loadFlags), &bank);
+    FmodBankFileData* fileData = nullptr;
+    auto result = LoadBankFile(bankPath, static_cast<FMOD_STUDIO_LOAD_BANK_FLAGS>(loadFlags), &bank, &fileData);
     if (result != FMOD_OK)
     {
         FMODLOG(Warning, "Failed to load bank at {}, Error: {}", bankPath, String(FMOD_ErrorString(result)));
         return;
     }
+    residency = AddBankResidency(bankPath, bank, fileData);
+    AddBankMetadata(bank);
     if (loadSampleData)
-        bank->loadSampleData();
-    _loadedBanks.Add(bankPath, bank);
+        AddLoadSampleDataRef(residency);
     FMODLOG(Info, "Bank {} loaded.", bankPath);
+    FmodAudio::BankLoaded(bankPath);
 }
 
 void FmodAudioSystem::LoadBank(const String& bankName, bool loadSampleData)
+{
+    const auto bankPath = FindBankPath(bankName);
+    if (bankPath.HasChars())
+        LoadBank(bankPath, FMOD_STUDIO_LOAD_BANK_NORMAL, loadSampleData);
+}
+
+FmodBankLoadHandle* FmodAudioSystem::LoadBankAsync(const StringView& bankPath, bool loadSampleData)
+{
+    FmodBankResidency* residency = nullptr;
+    FmodBankLoadHandle* handle = nullptr;
+    if (_loadedBanks.TryGet(bankPath, residency))
+    {
+        residency->MetadataRefs++;
+        if (loadSampleData)
+            AddLoadSampleDataRef(residency);
+        if (_bankLoadHandles.TryGet(bankPath, handle))
+            return handle;
+
+        // Already loaded synchronously.
+        handle = New<FmodBankLoadHandle>();
+        handle->BankPath = bankPath;
+        handle->_loadSampleData = loadSampleData;
+        handle->_bank = residency->Bank;
+        handle->_state = FmodBankLoadHandle::States::Loaded;
+        _bankLoadHandles.Add(handle->BankPath, handle);
+        return handle;
+    }
+
+    FMOD::Studio::Bank* bank = nullptr;
+    FmodBankFileData* fileData = nullptr;
+    auto result = LoadBankFile(bankPath, FMOD_STUDIO_LOAD_BANK_NONBLOCKING, &bank, &fileData);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to start loading bank at {}, Error: {}", bankPath, String(FMOD_ErrorString(result)));
+        FmodAudio::BankLoadFailed(String(bankPath));
+        return nullptr;
+    }
+
+    // Sample data is requested once the metadata is loaded.
+    handle = New<FmodBankLoadHandle>();
+    handle->BankPath = bankPath;
+    handle->_loadSampleData = loadSampleData;
+    residency = AddBankResidency(bankPath, bank, fileData);
+    if (loadSampleData)
+        AddLoadSampleDataRef(residency);
+    handle->_bank = bank;
+    _bankLoadHandles.Add(handle->BankPath, handle);
+    _pendingBankLoads.Add(handle);
+    return handle;
+}
+
+FmodBankLoadHandle* FmodAudioSystem::LoadBankAsync(const String& bankName, bool loadSampleData)
+{
+    const auto bankPath = FindBankPath(bankName);
+    if (bankPath.IsEmpty())
+        return nullptr;
+    return LoadBankAsync(StringView(bankPath), loadSampleData);
+}
+
+void FmodAudioSystem::UpdateBankLoads()
+{
+    Array<FmodBankLoadHandle*, InlinedAllocation<8>> finishedLoads;
+    for (int i = _pendingBankLoads.Count() - 1; i >= 0; i--)
+    {
+        auto handle = _pendingBankLoads[i];
+        FMOD_STUDIO_LOADING_STATE state = FMOD_STUDIO_LOADING_STATE_ERROR;
+        if (handle->_state == FmodBankLoadHandle::States::LoadingMetadata)
+        {
+            handle->_bank->getLoadingState(&state);
+            if (state == FMOD_STUDIO_LOADING_STATE_LOADING)
+                continue;
+            if (state == FMOD_STUDIO_LOADING_STATE_LOADED)
+            {
+                AddBankMetadata(handle->_bank);
+
+                // Other load requests may have referenced the sample data while the metadata was loading.
+                FmodBankResidency* residency = nullptr;
+                if (_loadedBanks.TryGet(handle->BankPath, residency) && residency->SampleDataRefs > 0)
+                    RequestSampleData(residency);
+                if (handle->_loadSampleData && residency && residency->SampleDataRequested)
+                {
+                    handle->_state = FmodBankLoadHandle::States::LoadingSampleData;
+                    continue;
+                }
+            }
+        }
+        else
+        {
+            // Sample data may still report unloaded until the load request is processed.
+            handle->_bank->getSampleLoadingState(&state);
+            if (state == FMOD_STUDIO_LOADING_STATE_LOADING || state == FMOD_STUDIO_LOADING_STATE_UNLOADED)
+                continue;
+        }
+
+        if (state == FMOD_STUDIO_LOADING_STATE_ERROR)
+        {
+            FMODLOG(Warning, "Failed to load bank at {}.", handle->BankPath);
+            ReleaseBankMetadata(handle->_bank);
+
+            // The failure undoes every load request that joined this one, none of them unloads the bank.
+            FmodBankResidency* residency = nullptr;
+            if (_loadedBanks.TryGet(handle->BankPath, residency))
+            {
+                residency->MetadataRefs = 0;
+                residency->SampleDataRefs = 0;
+                residency->LoadSampleDataRefs = 0;
+                _loadedBanks.Remove(handle->BankPath);
+                ReleaseBankResidency(residency);
+            }
+            _bankLoadHandles.Remove(handle->BankPath);
+            handle->_state = FmodBankLoadHandle::States::Failed;
+        }
+        else
+        {
+            FMODLOG(Info, "Bank {} loaded.", handle->BankPath);
+            handle->_state = FmodBankLoadHandle::States::Loaded;
+        }
+        _pendingBankLoads.RemoveAt(i);
+        finishedLoads.Add(handle);
+    }
+
+    if (finishedLoads.IsEmpty())
+        return;
+
+    // Fire events after the pending list is consistent since handlers may load or unload banks.
+    for (auto handle : finishedLoads)
+    {
+        if (handle->IsLoaded())
+        {
+            handle->Loaded();
+            FmodAudio::BankLoaded(handle->BankPath);
+        }
+        else
+        {
+            // Failed handles are not owned by a loaded bank anymore and are destroyed once the handlers ran.
+            handle->Failed();
+            FmodAudio::BankLoadFailed(handle->BankPath);
+            handle->DeleteObject();
+        }
+    }
+
+    CreateDeferredEventInstances();
+}
+
+bool FmodAudioSystem::DeferEventInstance(FmodAudioSource* source)
+{
+    if (_pendingBankLoads.IsEmpty())
+        return false;
+
+    // Only defer events that are not available yet, they may be in one of the loading banks.
+    const auto fmodEvent = source->Event.GetInstance();
+    if (fmodEvent->Guid.HasChars() ? _eventMetadata.ContainsKey(ToGuid(fmodEvent->GetFmodGuid())) : _eventMetadataByPath.ContainsKey(GetHash(fmodEvent->Path)))
+        return false;
+
+    _deferredSources.AddUnique(source);
+    return true;
+}
+
+void FmodAudioSystem::CancelDeferredEventInstance(FmodAudioSource* source)
+{
+    _deferredSources.Remove(source);
+}
+
+bool FmodAudioSystem::VirtualizeEventInstance(FmodAudioSource* source)
+{
+    if (!_settings->VirtualizeDistantSources || (_listenerTransformCount == 0 && FmodAudio::Listeners.IsEmpty()))
+        return false;
+
+    const auto fmodEvent = source->Event.GetInstance();
+    const auto metadata = fmodEvent->Guid.HasChars() ? GetEventMetadata(fmodEvent->GetFmodGuid()) : GetEventMetadata(fmodEvent->Path);
+    if (!metadata || !metadata->Is3D)
+        return false;
+    const Real maxDistance = (source->_overrideDistance ? source->_maxDistance : metadata->MaxDistance) + _settings->VirtualizationMargin;
+    if (GetListenerDistanceSquared(source->GetPosition()) <= maxDistance * maxDistance)
+        return false;
+
+    source->_virtual = true;
+    source->_virtualOneshot = metadata->IsOneshot;
+    source->_virtualMaxDistance = metadata->MaxDistance;
+    if (metadata->IsOneshot)
+        source->_playPending = false;
+    _hasVirtualSources = true;
+    return true;
+}
+
+void FmodAudioSystem::CreateDeferredEventInstances()
+{
+    if (_deferredSources.IsEmpty())
+        return;
+
+    // Sources defer again if their event is still not available.
+    auto deferredSources = _deferredSources;
+    _deferredSources.Clear();
+    for (auto source : deferredSources)
+        source->OnEventLoaded();
+}
+
+void FmodAudioSystem::ReleaseBankLoadHandle(const StringView& bankPath)
+{
+    FmodBankLoadHandle* handle = nullptr;
+    if (!_bankLoadHandles.TryGet(bankPath, handle))
+        return;
+    _pendingBankLoads.Remove(handle);
+    _bankLoadHandles.Remove(bankPath);
+    handle->DeleteObject();
+}
+
+String FmodAudioSystem::FindBankPath(const String& bankName)
 {
     // Search for bank file in paths.
     auto* settings = FmodAudioSettings::Get();
@@ -465,75 +1480,289 @@ void FmodAudioSystem::LoadBank(const String& bankName, bool loadSampleData)
     if (bankFiles.Count() == 0)
     {
         FMODLOG(Warning, "Can not load bank. Bank {} not found.", bankName);
+        return String::Empty;
+    }
+
+    return bankFiles[0];
+}
+
+void FmodAudioSystem::UnloadBank(const StringView& bankPath, bool releaseSampleData)
+{
+    FmodBankResidency* residency = nullptr;
+    if (!_loadedBanks.TryGet(bankPath, residency))
         return;
+
+    // Only the sample data reference taken by the load being undone is released, explicit sample data loads keep theirs.
+    if (releaseSampleData && residency->LoadSampleDataRefs > 0)
+    {
+        residency->LoadSampleDataRefs--;
+        ReleaseSampleDataRef(residency);
     }
 
-    auto bankPath = bankFiles[0];
-    
-    if (IsBankLoaded(bankPath))
+    // Keep the bank for the other load requests.
+    residency->MetadataRefs--;
+    if (residency->MetadataRefs > 0)
+        return;
+
+    const String path = residency->Path;
+    ReleaseBankLoadHandle(path);
+    ReleaseBankMetadata(residency->Bank);
+    _loadedBanks.Remove(path);
+    ReleaseBankResidency(residency);
+    FMODLOG(Info, "Bank {} unloaded.", path);
+}
+
+void FmodAudioSystem::UnloadBank(const String& bankName, bool releaseSampleData)
+{
+    if (const auto residency = FindBankResidency(bankName))
+        UnloadBank(StringView(residency->Path), releaseSampleData);
+}
+
+void FmodAudioSystem::UnloadAllBanks()
+{
+    for (auto& handle : _bankLoadHandles)
+        handle.Value->DeleteObject();
+    _bankLoadHandles.Clear();
+    _pendingBankLoads.Clear();
+    _deferredSources.Clear();
+    ReleaseAllMetadata();
+    for (auto& bank : _loadedBanks)
+        ReleaseBankResidency(bank.Value);
+    _loadedBanks.Clear();
+    FMODLOG(Info, "All banks unloaded.");
+}
+
+void FmodAudioSystem::LoadBankSampleData(const String& bankName)
+{
+    if (const auto residency = FindBankResidency(bankName))
+        AddSampleDataRef(residency);
+}
+
+void FmodAudioSystem::UnloadBankSampleData(const String& bankName)
+{
+    if (const auto residency = FindBankResidency(bankName))
+        ReleaseSampleDataRef(residency);
+}
+
+uint64 FmodAudioSystem::GetBankSampleDataSize(const String& bankName)
+{
+    const auto residency = FindBankResidency(bankName);
+    if (!residency || !residency->SampleDataRequested)
+        return 0;
+    FMOD_STUDIO_LOADING_STATE state;
+    if (residency->Bank->getSampleLoadingState(&state) != FMOD_OK || state != FMOD_STUDIO_LOADING_STATE_LOADED)
+        return 0;
+    return residency->SampleDataSize;
+}
+
+uint64 FmodAudioSystem::GetSampleDataMemoryUsage()
+{
+    // Fmod only reports memory usage with the logging libraries, so the tracked bank sizes are summed instead.
+    uint64 memoryUsage = 0;
+    for (const auto& bank : _loadedBanks)
+    {
+        if (bank.Value->SampleDataRequested)
+            memoryUsage += bank.Value->SampleDataSize;
+    }
+    return memoryUsage;
+}
+
+FMOD_RESULT FmodAudioSystem::LoadBankFile(const StringView& bankPath, FMOD_STUDIO_LOAD_BANK_FLAGS loadFlags, FMOD::Studio::Bank** bank, FmodBankFileData** fileData)
+{
+    switch (_settings->BankLoadMode)
+    {
+    case FmodBankLoadMode::FileSystem:
+        return FmodBankFileSystem::LoadBankCustom(_studioSystem, bankPath, loadFlags, bank);
+    case FmodBankLoadMode::MemoryMapped:
+        return FmodBankFileSystem::LoadBankMapped(_studioSystem, bankPath, loadFlags, bank, fileData);
+    default:
+        return _studioSystem->loadBankFile(bankPath.ToStringAnsi().GetText(), loadFlags, bank);
+    }
+}
+
+void FmodAudioSystem::LoadBankMemory(const String& bankName, const byte* data, uint32 length, bool loadSampleData)
+{
+    // Memory banks are keyed by file name so they can be found by name like file banks.
+    String bankFileName;
+    if (!bankName.EndsWith(TEXT(".bank")))
+        bankFileName = bankName + TEXT(".bank");
+    else
+        bankFileName = bankName;
+
+    FmodBankResidency* residency = nullptr;
+    if (_loadedBanks.TryGet(bankFileName, residency))
+    {
+        residency->MetadataRefs++;
+        if (loadSampleData)
+            AddLoadSampleDataRef(residency);
         return;
+    }
 
     FMOD::Studio::Bank* bank = nullptr;
-    auto result = _studioSystem->loadBankFile(bankPath.ToStringAnsi().GetText(), FMOD_STUDIO_LOAD_BANK_NORMAL, &bank);
+    auto result = FmodBankFileSystem::LoadBankMemory(_studioSystem, data, length, FMOD_STUDIO_LOAD_BANK_NORMAL, &bank);
     if (result != FMOD_OK)
     {
-        FMODLOG(Warning, "Failed to load bank at {}, Error: {}", bankPath, String(FMOD_ErrorString(result)));
+        FMODLOG(Warning, "Failed to load bank {} from memory, Error: {}", bankName, String(FMOD_ErrorString(result)));
         return;
     }
+    residency = AddBankResidency(bankFileName, bank);
+    residency->SampleDataSize = length;
+    AddBankMetadata(bank);
     if (loadSampleData)
-        bank->loadSampleData();
-    _loadedBanks.Add(bankPath, bank);
-    FMODLOG(Info, "Bank {} loaded.", bankPath);
+        AddLoadSampleDataRef(residency);
+    FMODLOG(Info, "Bank {} loaded from memory.", bankName);
+    FmodAudio::BankLoaded(bankFileName);
 }
 
-void FmodAudioSystem::UnloadBank(const StringView& bankPath)
+FmodBankResidency* FmodAudioSystem::AddBankResidency(const StringView& bankPath, FMOD::Studio::Bank* bank, FmodBankFileData* fileData)
 {
-    FMOD::Studio::Bank* bank = nullptr;
-    if (_loadedBanks.TryGet(bankPath, bank))
+    auto residency = New<FmodBankResidency>();
+    residency->Bank = bank;
+    residency->Path = bankPath;
+    residency->FileData = fileData;
+    residency->MetadataRefs = 1;
+    residency->SampleDataSize = fileData ? fileData->GetSize() : FileSystem::GetFileSize(residency->Path);
+    residency->LastUsedTime = GetTime();
+    bank->setUserData(residency);
+    _loadedBanks.Add(residency->Path, residency);
+    return residency;
+}
+
+void FmodAudioSystem::ReleaseBankResidency(FmodBankResidency* residency)
+{
+    // Banks are unloaded asynchronously, so memory fmod reads in place is kept until the unload finishes.
+    residency->Bank->unload();
+    _unloadingBanks.Add(residency);
+}
+
+void FmodAudioSystem::UpdateUnloadingBanks()
+{
+    Array<String, InlinedAllocation<8>> unloadedBanks;
+    for (int32 i = _unloadingBanks.Count() - 1; i >= 0; i--)
     {
-        bank->unload();
-        _loadedBanks.Remove(bankPath);
-        FMODLOG(Info, "Bank {} unloaded.", bankPath);
+        // The bank handle becomes invalid once the unload is done.
+        const auto residency = _unloadingBanks[i];
+        FMOD_STUDIO_LOADING_STATE state;
+        if (residency->Bank->getLoadingState(&state) == FMOD_OK && state != FMOD_STUDIO_LOADING_STATE_UNLOADED)
+            continue;
+        _unloadingBanks.RemoveAtKeepOrder(i);
+        unloadedBanks.Add(residency->Path);
+        if (residency->FileData)
+            Delete(residency->FileData);
+        Delete(residency);
     }
+
+    // Fire events after the unloading list is consistent since handlers may load or unload banks.
+    for (const auto& bankPath : unloadedBanks)
+        FmodAudio::BankUnloaded(bankPath);
 }
 
-void FmodAudioSystem::UnloadBank(const String& bankName)
+FmodBankResidency* FmodAudioSystem::FindBankResidency(const String& bankName)
 {
     String bankFileName;
     if (!bankName.EndsWith(TEXT(".bank")))
         bankFileName = bankName + TEXT(".bank");
     else
         bankFileName = bankName;
-    
+
     for (auto& bank : _loadedBanks)
     {
         if (bank.Key.EndsWith(bankFileName))
-        {
-            bank.Value->unload();
-            FMODLOG(Info, "Bank {} unloaded.", bank.Key);
-            _loadedBanks.Remove(bank.Key);
-            break;
-        }
+            return bank.Value;
     }
+    return nullptr;
 }
 
-void FmodAudioSystem::UnloadAllBanks()
+void FmodAudioSystem::AddLoadSampleDataRef(FmodBankResidency* residency)
+{
+    residency->LoadSampleDataRefs++;
+    AddSampleDataRef(residency);
+}
+
+void FmodAudioSystem::AddSampleDataRef(FmodBankResidency* residency)
+{
+    residency->SampleDataRefs++;
+    residency->LastUsedTime = GetTime();
+
+    // Pending asynchronous loads request the sample data once the metadata is loaded.
+    FMOD_STUDIO_LOADING_STATE state;
+    if (residency->Bank->getLoadingState(&state) == FMOD_OK && state == FMOD_STUDIO_LOADING_STATE_LOADED)
+        RequestSampleData(residency);
+}
+
+void FmodAudioSystem::ReleaseSampleDataRef(FmodBankResidency* residency)
+{
+    if (residency->SampleDataRefs == 0)
+        return;
+
+    // Unreferenced sample data stays loaded until it is evicted to stay in the memory budget.
+    residency->SampleDataRefs--;
+    if (residency->SampleDataRefs == 0)
+        residency->LastUsedTime = GetTime();
+}
+
+void FmodAudioSystem::RequestSampleData(FmodBankResidency* residency)
+{
+    // Fmod reference counts sample data loads so only one request is kept per bank.
+    if (residency->SampleDataRequested)
+        return;
+    auto result = residency->Bank->loadSampleData();
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to load sample data for bank {}, Error: {}", residency->Path, String(FMOD_ErrorString(result)));
+        return;
+    }
+    residency->SampleDataRequested = true;
+}
+
+void FmodAudioSystem::TouchBank(const FmodEventMetadata* metadata)
+{
+    void* userData = nullptr;
+    if (metadata->Bank && metadata->Bank->getUserData(&userData) == FMOD_OK && userData)
+        static_cast<FmodBankResidency*>(userData)->LastUsedTime = GetTime();
+}
+
+void FmodAudioSystem::UpdateBankResidency()
 {
+    const uint64 budget = static_cast<uint64>(_settings->SampleDataMemoryBudget) * 1024 * 1024;
+    if (budget == 0)
+        return;
+    uint64 memoryUsage = GetSampleDataMemoryUsage();
+    if (memoryUsage <= budget)
+        return;
+
+    Array<FmodBankResidency*, InlinedAllocation<32>> candidates;
     for (auto& bank : _loadedBanks)
     {
-        bank.Value->unload();
+        if (bank.Value->IsSampleDataEvictable())
+            candidates.Add(bank.Value);
+    }
+    if (candidates.IsEmpty())
+        return;
+
+    // Evict the least recently used sample data first.
+    Sorting::QuickSort(candidates.Get(), candidates.Count(), [](FmodBankResidency* const& a, FmodBankResidency* const& b)
+    {
+        return a->LastUsedTime < b->LastUsedTime;
+    });
+    for (auto residency : candidates)
+    {
+        if (memoryUsage <= budget)
+            break;
+        residency->Bank->unloadSampleData();
+        residency->SampleDataRequested = false;
+        memoryUsage -= Math::Min(memoryUsage, residency->SampleDataSize);
+        FMODLOG(Info, "Evicted sample data for bank {}.", residency->Path);
     }
-    _loadedBanks.Clear();
-    FMODLOG(Info, "All banks unloaded.");
 }
 
 bool FmodAudioSystem::IsBankLoaded(const StringView& bankPath)
 {
-    FMOD::Studio::Bank* fmodBank;
-    if (_loadedBanks.TryGet(bankPath, fmodBank))
+    FmodBankResidency* residency;
+    if (_loadedBanks.TryGet(bankPath, residency))
     {
         FMOD_STUDIO_LOADING_STATE state;
-        FMOD_RESULT result = fmodBank->getLoadingState(&state);
+        FMOD_RESULT result = residency->Bank->getLoadingState(&state);
         if (result == FMOD_OK && state == FMOD_STUDIO_LOADING_STATE_LOADED)
         {
             return true;
@@ -562,90 +1791,95 @@ bool FmodAudioSystem::CheckBankLoaded(const String& bankName)
     return false;
 }
 
-void* FmodAudioSystem::CreateEventInstance(const StringView& eventPath, FmodAudioSource* source)
+FmodEventHandle FmodAudioSystem::CreateEventInstance(const StringView& eventPath, FmodAudioSource* source)
 {
-    FMOD::Studio::EventDescription* eventDescription = nullptr;
-    FMOD_RESULT result = _studioSystem->getEvent(eventPath.ToStringAnsi().GetText(), &eventDescription);
+    const auto metadata = GetEventMetadata(eventPath);
+    if (!metadata)
+        return FmodEventHandle();
 
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get event description at {}, Error: {}", eventPath, String(FMOD_ErrorString(result)));
-        return nullptr;
-    }
-
-    FMOD::Studio::EventInstance* eventInstance = nullptr;
-    result = eventDescription->createInstance(&eventInstance);
-
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to create event instance at {}, Error: {}", eventPath, String(FMOD_ErrorString(result)));
-        return nullptr;
-    }
+    const auto eventInstance = AcquireEventInstance(metadata);
+    if (!eventInstance)
+        return FmodEventHandle();
 
     FMODLOG(Info, "Event {} created.", eventPath);
-    EventMap.Add(eventInstance, source);
-    return eventInstance;
+    return AddEventInstance(eventInstance, metadata, source);
 }
 
-void* FmodAudioSystem::CreateEventInstance(const FMOD_GUID& eventGuid, FmodAudioSource* source)
+FmodEventHandle FmodAudioSystem::CreateEventInstance(const FMOD_GUID& eventGuid, FmodAudioSource* source)
 {
-    FMOD::Studio::EventDescription* eventDescription = nullptr;
-    FMOD_RESULT result = _studioSystem->getEventByID(&eventGuid, &eventDescription);
-
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get event description, Error: {}", String(FMOD_ErrorString(result)));
-        return nullptr;
-    }
-
-    FMOD::Studio::EventInstance* eventInstance = nullptr;
-    result = eventDescription->createInstance(&eventInstance);
+    const auto metadata = GetEventMetadata(eventGuid);
+    if (!metadata)
+        return FmodEventHandle();
 
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to create event instance, Error: {}", String(FMOD_ErrorString(result)));
-        return nullptr;
-    }
-    EventMap.Add(eventInstance, source);
-    return eventInstance;
+    const auto eventInstance = AcquireEventInstance(metadata);
+    if (!eventInstance)
+        return FmodEventHandle();
+    return AddEventInstance(eventInstance, metadata, source);
 }
 
-void FmodAudioSystem::ReleaseEventInstance(void* eventInstance)
+void FmodAudioSystem::ReleaseEventInstance(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instanceData = FindEventInstance(eventInstance);
+    if (!instanceData)
         return;
+    const auto instance = instanceData->Instance;
+    const auto metadata = instanceData->Metadata;
 
-    FMOD::Studio::EventInstance* instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
+    // Detach the owner before stopping so its stopped callback reaches neither the owner nor the next user of the instance.
+    instance->setCallback(nullptr, 0);
+    instance->setUserData(nullptr);
+    RemoveEventInstance(eventInstance);
 
     // Stop event if playing.
     auto result = instance->stop(FMOD_STUDIO_STOP_IMMEDIATE);
     if (result != FMOD_OK)
-    {
         FMODLOG(Warning, "Failed to stop event instance. Error: {}", String(FMOD_ErrorString(result)));
-        return;
+    else if (metadata->Pool.Count() < metadata->WarmCount)
+    {
+        // A playing instance goes back to the pool once its own stopped callback is dispatched.
+        FMOD_STUDIO_PLAYBACK_STATE state = FMOD_STUDIO_PLAYBACK_STOPPED;
+        instance->getPlaybackState(&state);
+        if (state == FMOD_STUDIO_PLAYBACK_STOPPED)
+        {
+            if (ReturnEventInstance(instance, metadata))
+                return;
+        }
+        else
+        {
+            // The instance is released when it could not be added.
+            if (const auto stoppingData = FindEventInstance(AddEventInstance(instance, metadata, nullptr)))
+            {
+                stoppingData->Pooled = true;
+                instance->setCallback(&OnEventInstanceCallback, FMOD_STUDIO_EVENT_CALLBACK_STOPPED);
+            }
+            return;
+        }
     }
 
-    EventMap.Remove(eventInstance);
     result = instance->release();
     if (result != FMOD_OK)
         FMODLOG(Warning, "Failed to release event instance. Error: {}", String(FMOD_ErrorString(result)));
 
     FMODLOG(Info, "Event released.");
-    eventInstance = nullptr;
 }
 
-void FmodAudioSystem::PlayEvent(void* eventInstance)
+void FmodAudioSystem::PlayEvent(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->start();
+    instance->start();
 }
 
-bool FmodAudioSystem::IsEventPlaying(void* eventInstance)
+bool FmodAudioSystem::IsEventPlaying(FmodEventHandle eventInstance)
 {
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
+        return false;
+
     FMOD_STUDIO_PLAYBACK_STATE state;
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->getPlaybackState(&state);
+    instance->getPlaybackState(&state);
 
     if (state == FMOD_STUDIO_PLAYBACK_PLAYING)
         return true;
@@ -653,178 +1887,280 @@ bool FmodAudioSystem::IsEventPlaying(void* eventInstance)
     return false;
 }
 
-void FmodAudioSystem::StopEvent(void* eventInstance, int stopMode)
+bool FmodAudioSystem::IsEventStopped(FmodEventHandle eventInstance)
+{
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
+        return true;
+
+    FMOD_STUDIO_PLAYBACK_STATE state;
+    auto result = instance->getPlaybackState(&state);
+    return result != FMOD_OK || state == FMOD_STUDIO_PLAYBACK_STOPPED;
+}
+
+void FmodAudioSystem::StopEvent(FmodEventHandle eventInstance, int stopMode)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->stop(static_cast<FMOD_STUDIO_STOP_MODE>(stopMode));
+    instance->stop(static_cast<FMOD_STUDIO_STOP_MODE>(stopMode));
 }
 
-void FmodAudioSystem::PauseEvent(void* eventInstance, bool pause)
+void FmodAudioSystem::PauseEvent(FmodEventHandle eventInstance, bool pause)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->setPaused(pause);
+    instance->setPaused(pause);
 }
 
-bool FmodAudioSystem::IsEventPaused(void* eventInstance)
+bool FmodAudioSystem::IsEventPaused(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return false;
 
     bool result;
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->getPaused(&result);
+    instance->getPaused(&result);
     return result;
 }
 
-bool FmodAudioSystem::IsEvent3D(void* eventInstance)
+bool FmodAudioSystem::IsEvent3D(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instanceData = GetEventInstanceData(eventInstance);
+    if (!instanceData)
         return false;
-
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
-    FMOD::Studio::EventDescription* eventDescription = nullptr;
-    instance->getDescription(&eventDescription);
-    if (eventDescription)
-    {
-        bool is3D = false;
-        eventDescription->is3D(&is3D);
-        return is3D;
-    }
-    return false;
+    return instanceData->Metadata->Is3D;
 }
 
-void FmodAudioSystem::SetEventVolumeMultiplier(void* eventInstance, float volumeScale)
+void FmodAudioSystem::SetEventVolumeMultiplier(FmodEventHandle eventInstance, float volumeScale)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->setVolume(volumeScale);
+    instance->setVolume(volumeScale);
 }
 
-void FmodAudioSystem::SetEventPitchMultiplier(void* eventInstance, float pitch)
+void FmodAudioSystem::SetEventPitchMultiplier(FmodEventHandle eventInstance, float pitch)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->setPitch(pitch);
+    instance->setPitch(pitch);
 }
 
-float FmodAudioSystem::GetEventMinDistance(void* eventInstance)
+float FmodAudioSystem::GetEventMinDistance(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instanceData = GetEventInstanceData(eventInstance);
+    if (!instanceData)
         return -1.0f;
-
-    float minDistance;
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->getMinMaxDistance(&minDistance, nullptr);
-    return minDistance;
+    return instanceData->MinDistance;
 }
 
-float FmodAudioSystem::GetEventMaxDistance(void* eventInstance)
+float FmodAudioSystem::GetEventMaxDistance(FmodEventHandle eventInstance)
 {
-    if (!eventInstance)
+    const auto instanceData = GetEventInstanceData(eventInstance);
+    if (!instanceData)
         return -1.0f;
-
-    float maxDistance;
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->getMinMaxDistance(nullptr, &maxDistance);
-    return maxDistance;
+    return instanceData->MaxDistance;
 }
 
-void FmodAudioSystem::SetEventMaxDistance(void* eventInstance, float maxDistance)
+void FmodAudioSystem::SetEventMaxDistance(FmodEventHandle eventInstance, float maxDistance)
 {
-    if (!eventInstance)
+    const auto instanceData = FindEventInstance(eventInstance);
+    if (!instanceData)
         return;
 
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
-    instance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MAXIMUM_DISTANCE, maxDistance);
+    instanceData->Instance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MAXIMUM_DISTANCE, maxDistance);
+
+    // Negative value restores the distance authored in fmod studio.
+    instanceData->MaxDistance = maxDistance < 0.0f ? instanceData->Metadata->MaxDistance : maxDistance;
 }
 
-void FmodAudioSystem::SetEventMinDistance(void* eventInstance, float minDistance)
+void FmodAudioSystem::SetEventMinDistance(FmodEventHandle eventInstance, float minDistance)
 {
-    if (!eventInstance)
+    const auto instanceData = FindEventInstance(eventInstance);
+    if (!instanceData)
         return;
 
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
-    instance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MINIMUM_DISTANCE, minDistance);
+    instanceData->Instance->setProperty(FMOD_STUDIO_EVENT_PROPERTY_MINIMUM_DISTANCE, minDistance);
+
+    // Negative value restores the distance authored in fmod studio.
+    instanceData->MinDistance = minDistance < 0.0f ? instanceData->Metadata->MinDistance : minDistance;
 }
 
-void FmodAudioSystem::SetEventParameter(void* eventInstance, const StringView& parameterName, float value)
+void FmodAudioSystem::SetEventParameter(FmodEventHandle eventInstance, const StringView& parameterName, float value)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
 
-    auto result = static_cast<FMOD::Studio::EventInstance*>(eventInstance)->setParameterByName(
+    const auto parameterId = GetEventParameterId(eventInstance, parameterName);
+    if (parameterId.IsValid())
+    {
+        SetEventParameter(eventInstance, parameterId, value);
+        return;
+    }
+
+    auto result = instance->setParameterByName(
         parameterName.ToStringAnsi().GetText(), value);
     if (result != FMOD_OK)
         FMODLOG(Warning, "Failed to set event parameter {}. Error: {}", parameterName.ToString(),
             String(FMOD_ErrorString(result)));
 }
 
-float FmodAudioSystem::GetEventParameter(void* eventInstance, const StringView& parameterName)
+float FmodAudioSystem::GetEventParameter(FmodEventHandle eventInstance, const StringView& parameterName)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return -1.0f;
 
+    const auto parameterId = GetEventParameterId(eventInstance, parameterName);
+    if (parameterId.IsValid())
+        return GetEventParameter(eventInstance, parameterId);
+
     float value = -1.0f;
-    auto result = static_cast<FMOD::Studio::EventInstance*>(eventInstance)->getParameterByName(parameterName.ToStringAnsi().GetText(), &value);
+    auto result = instance->getParameterByName(parameterName.ToStringAnsi().GetText(), &value);
     if (result != FMOD_OK)
         FMODLOG(Warning, "Failed to get event parameter {}. Error: {}", parameterName.ToString(),
             String(FMOD_ErrorString(result)));
     return value;
 }
 
-float FmodAudioSystem::GetEventLength(void* eventInstance)
+FmodParameterId FmodAudioSystem::GetEventParameterId(FmodEventHandle eventInstance, const StringView& parameterName)
 {
-    if (!eventInstance)
+    const auto instanceData = GetEventInstanceData(eventInstance);
+    return instanceData ? GetEventParameterId(instanceData->Metadata, parameterName) : FmodParameterId();
+}
+
+FmodParameterId FmodAudioSystem::GetEventParameterId(const FmodEventMetadata* metadata, const StringView& parameterName)
+{
+    FmodParameterId parameterId;
+    if (metadata)
+        metadata->ParameterIds.TryGet(parameterName, parameterId);
+    return parameterId;
+}
+
+void FmodAudioSystem::SetEventParameter(FmodEventHandle eventInstance, const FmodParameterId& parameterId, float value)
+{
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance || !parameterId.IsValid())
+        return;
+
+    auto result = instance->setParameterByID(parameterId.ToFmod(), value);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to set event parameter by id. Error: {}", String(FMOD_ErrorString(result)));
+}
+
+float FmodAudioSystem::GetEventParameter(FmodEventHandle eventInstance, const FmodParameterId& parameterId)
+{
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance || !parameterId.IsValid())
         return -1.0f;
 
-    FMOD::Studio::EventDescription* eventDescription = nullptr;
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
-    instance->getDescription(&eventDescription);
+    float value = -1.0f;
+    auto result = instance->getParameterByID(parameterId.ToFmod(), &value);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to get event parameter by id. Error: {}", String(FMOD_ErrorString(result)));
+    return value;
+}
 
-    int length = -1;
-    eventDescription->getLength(&length);
-    return static_cast<float>(length) * 0.001f;
+void FmodAudioSystem::SetEventParameters(FmodEventHandle eventInstance, const FmodParameterId* parameterIds, const float* values, int32 count)
+{
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance || count <= 0)
+        return;
+
+    auto result = instance->setParametersByIDs(
+        reinterpret_cast<const FMOD_STUDIO_PARAMETER_ID*>(parameterIds), const_cast<float*>(values), count);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to set {} event parameters by id. Error: {}", count, String(FMOD_ErrorString(result)));
+}
+
+float FmodAudioSystem::GetEventLength(FmodEventHandle eventInstance)
+{
+    const auto instanceData = GetEventInstanceData(eventInstance);
+    if (!instanceData)
+        return -1.0f;
+    return instanceData->Metadata->Length;
 }
 
 float FmodAudioSystem::GetEventLength(const String& eventPath)
 {
+    const auto metadata = GetEventMetadata(eventPath);
+    if (!metadata)
+        return -1.0f;
+    return metadata->Length;
+}
+
+const FmodEventMetadata* FmodAudioSystem::GetEventMetadata(const StringView& eventPath)
+{
+    FmodEventMetadata* metadata = nullptr;
+    if (_eventMetadataByPath.TryGet(GetHash(eventPath), metadata) && eventPath == metadata->Path)
+        return metadata;
+
+    // Slow path for events that were not cached when their bank loaded.
     FMOD::Studio::EventDescription* eventDescription = nullptr;
     auto result = _studioSystem->getEvent(eventPath.ToStringAnsi().GetText(), &eventDescription);
     if (result != FMOD_OK)
     {
         FMODLOG(Warning, "Failed to get event description at {}, Error: {}", eventPath, String(FMOD_ErrorString(result)));
-        return -1.0f;
+        return nullptr;
     }
+    return AddEventMetadata(eventDescription, nullptr);
+}
 
-    int length = -1;
-    eventDescription->getLength(&length);
-    return static_cast<float>(length) * 0.001f;
+const FmodEventMetadata* FmodAudioSystem::GetEventMetadata(const FMOD_GUID& eventGuid)
+{
+    FmodEventMetadata* metadata = nullptr;
+    if (_eventMetadata.TryGet(ToGuid(eventGuid), metadata))
+        return metadata;
+
+    // Slow path for events that were not cached when their bank loaded.
+    FMOD::Studio::EventDescription* eventDescription = nullptr;
+    auto result = _studioSystem->getEventByID(&eventGuid, &eventDescription);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to get event description, Error: {}", String(FMOD_ErrorString(result)));
+        return nullptr;
+    }
+    return AddEventMetadata(eventDescription, nullptr);
 }
 
-float FmodAudioSystem::GetEventPosition(void* eventInstance)
+const FmodEventInstanceData* FmodAudioSystem::GetEventInstanceData(FmodEventHandle eventInstance) const
 {
-    if (!eventInstance)
+    return const_cast<FmodAudioSystem*>(this)->FindEventInstance(eventInstance);
+}
+
+float FmodAudioSystem::GetEventPosition(FmodEventHandle eventInstance)
+{
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return -1.0f;
 
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
     int position = 0;
     instance->getTimelinePosition(&position);
     return static_cast<float>(position) * 0.001f;
 }
 
-void FmodAudioSystem::SetEventPosition(void* eventInstance, float position)
+void FmodAudioSystem::SetEventPosition(FmodEventHandle eventInstance, float position)
 {
-    if (!eventInstance)
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
         return;
-    auto instance = static_cast<FMOD::Studio::EventInstance*>(eventInstance);
     instance->setTimelinePosition(static_cast<int>(position * 1000.0f));
 }
 
-void FmodAudioSystem::RegisterEventCallback(void* eventInstance, bool marker, bool beat)
+void FmodAudioSystem::RegisterEventCallback(FmodEventHandle eventInstance, bool marker, bool beat)
 {
+    const auto instance = GetEventInstance(eventInstance);
+    if (!instance)
+        return;
+
     FMOD_STUDIO_EVENT_CALLBACK_TYPE callBacks =
         FMOD_STUDIO_EVENT_CALLBACK_STARTING |
             FMOD_STUDIO_EVENT_CALLBACK_STARTED |
@@ -835,7 +2171,173 @@ void FmodAudioSystem::RegisterEventCallback(void* eventInstance, bool marker, bo
         callBacks |= FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_MARKER;
     if (beat)
         callBacks |= FMOD_STUDIO_EVENT_CALLBACK_TIMELINE_BEAT | FMOD_STUDIO_EVENT_CALLBACK_NESTED_TIMELINE_BEAT;
-    static_cast<FMOD::Studio::EventInstance*>(eventInstance)->setCallback(&OnEventInstanceCallback, callBacks);
+    instance->setCallback(&OnEventInstanceCallback, callBacks);
+}
+
+void FmodAudioSystem::PlayOneShot(const FMOD_GUID& eventGuid, const Vector3& position)
+{
+    const auto metadata = GetEventMetadata(eventGuid);
+    if (metadata)
+        PlayOneShot(metadata, position);
+}
+
+void FmodAudioSystem::PlayOneShot(const StringView& eventPath, const Vector3& position)
+{
+    const auto metadata = GetEventMetadata(eventPath);
+    if (metadata)
+        PlayOneShot(metadata, position);
+}
+
+void FmodAudioSystem::PlayOneShot(const FmodEvent* event, const Vector3& position)
+{
+    // Limits are checked first so rejected one-shots cost no fmod calls, they are applied once the instance is acquired.
+    if (!CheckEventLimits(event))
+        return;
+    const auto metadata = event->Guid.HasChars() ? GetEventMetadata(event->GetFmodGuid()) : GetEventMetadata(event->Path);
+    if (metadata)
+        PlayOneShot(metadata, position, event);
+}
+
+void FmodAudioSystem::PlayOneShot(const FmodEventMetadata* metadata, const Vector3& position, const FmodEvent* limits)
+{
+    if (limits)
+        WarmEventInstances(limits, metadata);
+    const auto eventInstance = AcquireEventInstance(metadata);
+    if (!eventInstance)
+        return;
+    TouchBank(metadata);
+
+    if (metadata->Is3D)
+    {
+        FMOD_3D_ATTRIBUTES attributes;
+        GetOneShotAttributes(position, _audioOrigin, attributes);
+        eventInstance->set3DAttributes(&attributes);
+    }
+
+    // Limited and pooled one-shots are tracked until their stopped callback is dispatched.
+    // With large worlds, 3D one-shots are tracked too so their position is sent again when the audio origin moves.
+    const bool pooled = metadata->WarmCount > 0;
+#if USE_LARGE_WORLDS
+    const bool tracked = pooled || metadata->Is3D || (limits && limits->MaxInstances > 0);
+#else
+    const bool tracked = pooled || (limits && limits->MaxInstances > 0);
+#endif
+    FmodEventHandle handle;
+    if (tracked)
+    {
+        handle = AddEventInstance(eventInstance, metadata, nullptr);
+        const auto instanceData = FindEventInstance(handle);
+        if (!instanceData)
+        {
+            // The instance was released when it could not be added.
+            return;
+        }
+        instanceData->Position = position;
+        instanceData->Pooled = pooled;
+        eventInstance->setCallback(&OnEventInstanceCallback, FMOD_STUDIO_EVENT_CALLBACK_STOPPED);
+    }
+
+    // Other instances are only stolen once this one is sure to start.
+    if (limits)
+    {
+        ApplyEventLimits(limits);
+        AddLimitedEventInstance(limits, handle);
+    }
+
+    // Released instances are destroyed by fmod once they stop playing.
+    eventInstance->start();
+    if (!pooled)
+        eventInstance->release();
+}
+
+bool FmodAudioSystem::CheckEventLimits(const FmodEvent* event)
+{
+    if (!event->HasLimits())
+        return true;
+
+    const double now = GetTime();
+    if (now - event->_lastStartTime < event->MinRetriggerInterval)
+        return false;
+
+    if (event->MaxInstances > 0)
+    {
+        // Forget the instances that stopped or were released, the rest stay ordered by start time.
+        auto& instances = event->_limitedInstances;
+        for (int32 i = instances.Count() - 1; i >= 0; i--)
+        {
+            const auto instanceData = FindEventInstance(instances[i]);
+            if (!instanceData || !instanceData->Limited)
+                instances.RemoveAtKeepOrder(i);
+        }
+
+        if (instances.Count() >= event->MaxInstances && event->StealMode == FmodEventStealMode::None)
+            return false;
+    }
+    return true;
+}
+
+void FmodAudioSystem::ApplyEventLimits(const FmodEvent* event)
+{
+    if (!event->HasLimits())
+        return;
+
+    if (event->MaxInstances > 0)
+    {
+        // CheckEventLimits already forgot the stopped instances and only lets a full list through with a steal mode.
+        auto& instances = event->_limitedInstances;
+        if (instances.Count() >= event->MaxInstances)
+        {
+            int32 victim = 0;
+            if (event->StealMode == FmodEventStealMode::Quietest)
+            {
+                float minAudibility = MAX_float;
+                for (int32 i = 0; i < instances.Count(); i++)
+                {
+                    const auto instance = FindEventInstance(instances[i])->Instance;
+                    float volume = 0.0f, audibility = 0.0f;
+                    FMOD::ChannelGroup* channelGroup = nullptr;
+                    if (instance->getChannelGroup(&channelGroup) != FMOD_OK || channelGroup->getAudibility(&audibility) != FMOD_OK)
+                        instance->getVolume(&volume, &audibility);
+                    if (audibility < minAudibility)
+                    {
+                        minAudibility = audibility;
+                        victim = i;
+                    }
+                }
+            }
+            else if (event->StealMode == FmodEventStealMode::Furthest)
+            {
+                Real maxDistance = -1;
+                for (int32 i = 0; i < instances.Count(); i++)
+                {
+                    const auto instanceData = FindEventInstance(instances[i]);
+                    const Vector3 position = instanceData->Source ? instanceData->Source->GetPosition() : instanceData->Position;
+                    const Real distance = GetListenerDistanceSquared(position);
+                    if (distance > maxDistance)
+                    {
+                        maxDistance = distance;
+                        victim = i;
+                    }
+                }
+            }
+
+            const auto instanceData = FindEventInstance(instances[victim]);
+            instanceData->Instance->stop(FMOD_STUDIO_STOP_IMMEDIATE);
+            instanceData->Limited = false;
+            instances.RemoveAtKeepOrder(victim);
+        }
+    }
+
+    event->_lastStartTime = GetTime();
+}
+
+void FmodAudioSystem::AddLimitedEventInstance(const FmodEvent* event, FmodEventHandle eventInstance)
+{
+    const auto instanceData = FindEventInstance(eventInstance);
+    if (!instanceData || instanceData->Limited || event->MaxInstances <= 0)
+        return;
+    instanceData->Limited = true;
+    event->_limitedInstances.Add(eventInstance);
 }
 
 void FmodAudioSystem::SetDriver(int index)
@@ -883,6 +2385,13 @@ void FmodAudioSystem::SetGlobalParameter(const StringView& parameterName, float
     if (!_studioSystem)
         return;
 
+    const auto parameterId = GetGlobalParameterId(parameterName);
+    if (parameterId.IsValid())
+    {
+        SetGlobalParameter(parameterId, value);
+        return;
+    }
+
     auto result = _studioSystem->setParameterByName(parameterName.ToStringAnsi().GetText(), value);
     if (result != FMOD_OK)
         FMODLOG(Warning, "Failed to set global parameter {}. Error: {}", parameterName.ToString(), String(FMOD_ErrorString(result)));
@@ -893,6 +2402,10 @@ float FmodAudioSystem::GetGlobalParameter(const StringView& parameterName)
     if (!_studioSystem)
         return -1.0f;
 
+    const auto parameterId = GetGlobalParameterId(parameterName);
+    if (parameterId.IsValid())
+        return GetGlobalParameter(parameterId);
+
     float value = -1.0f;
     auto result = _studioSystem->getParameterByName(parameterName.ToStringAnsi().GetText(), &value);
     if (result != FMOD_OK)
@@ -900,27 +2413,137 @@ float FmodAudioSystem::GetGlobalParameter(const StringView& parameterName)
     return value;
 }
 
-void FmodAudioSystem::SetBusMute(const String& busPath, bool mute)
+FmodParameterId FmodAudioSystem::GetGlobalParameterId(const StringView& parameterName)
+{
+    FmodParameterId parameterId;
+    if (!_studioSystem || _globalParameterIds.TryGet(parameterName, parameterId))
+        return parameterId;
+
+    FMOD_STUDIO_PARAMETER_DESCRIPTION parameterDescription;
+    auto result = _studioSystem->getParameterDescriptionByName(parameterName.ToStringAnsi().GetText(), &parameterDescription);
+    if (result != FMOD_OK)
+        return parameterId;
+
+    parameterId = FmodParameterId(parameterDescription.id);
+    _globalParameterIds.Add(String(parameterName), parameterId);
+    return parameterId;
+}
+
+void FmodAudioSystem::SetGlobalParameter(const FmodParameterId& parameterId, float value)
+{
+    if (!_studioSystem || !parameterId.IsValid())
+        return;
+
+    auto result = _studioSystem->setParameterByID(parameterId.ToFmod(), value);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to set global parameter by id. Error: {}", String(FMOD_ErrorString(result)));
+}
+
+float FmodAudioSystem::GetGlobalParameter(const FmodParameterId& parameterId)
+{
+    if (!_studioSystem || !parameterId.IsValid())
+        return -1.0f;
+
+    float value = -1.0f;
+    auto result = _studioSystem->getParameterByID(parameterId.ToFmod(), &value);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to get global parameter by id. Error: {}", String(FMOD_ErrorString(result)));
+    return value;
+}
+
+void FmodAudioSystem::SetGlobalParameters(const FmodParameterId* parameterIds, const float* values, int32 count)
+{
+    if (!_studioSystem || count <= 0)
+        return;
+
+    auto result = _studioSystem->setParametersByIDs(reinterpret_cast<const FMOD_STUDIO_PARAMETER_ID*>(parameterIds), const_cast<float*>(values), count);
+    if (result != FMOD_OK)
+        FMODLOG(Warning, "Failed to set {} global parameters by id. Error: {}", count, String(FMOD_ErrorString(result)));
+}
+
+FMOD::Studio::Bus* FmodAudioSystem::GetBus(const StringView& busPath)
 {
     FMOD::Studio::Bus* bus = nullptr;
+    if (_busesByPath.TryGet(busPath, bus))
+        return bus;
+
+    // Slow path for buses that were not cached when their bank loaded.
     auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
     if (result != FMOD_OK)
     {
         FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
-        return;
+        return nullptr;
     }
-    bus->setMute(mute);
+    _busesByPath[busPath] = bus;
+    return bus;
 }
 
-bool FmodAudioSystem::GetBusMute(const String& busPath)
+FMOD::Studio::Bus* FmodAudioSystem::GetBus(const FMOD_GUID& busGuid)
 {
     FMOD::Studio::Bus* bus = nullptr;
-    auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
+    const Guid id = ToGuid(busGuid);
+    if (_buses.TryGet(id, bus))
+        return bus;
+
+    // Slow path for buses that were not cached when their bank loaded.
+    auto result = _studioSystem->getBusByID(&busGuid, &bus);
     if (result != FMOD_OK)
     {
-        FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
-        return false;
+        FMODLOG(Warning, "Failed to get bus, Error: {}", String(FMOD_ErrorString(result)));
+        return nullptr;
+    }
+    _buses[id] = bus;
+    return bus;
+}
+
+FMOD::Studio::VCA* FmodAudioSystem::GetVCA(const StringView& vcaPath)
+{
+    FMOD::Studio::VCA* vca = nullptr;
+    if (_vcasByPath.TryGet(vcaPath, vca))
+        return vca;
+
+    // Slow path for VCAs that were not cached when their bank loaded.
+    auto result = _studioSystem->getVCA(vcaPath.ToStringAnsi().GetText(), &vca);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to get VCA at {}, Error: {}", vcaPath, String(FMOD_ErrorString(result)));
+        return nullptr;
+    }
+    _vcasByPath[vcaPath] = vca;
+    return vca;
+}
+
+FMOD::Studio::VCA* FmodAudioSystem::GetVCA(const FMOD_GUID& vcaGuid)
+{
+    FMOD::Studio::VCA* vca = nullptr;
+    const Guid id = ToGuid(vcaGuid);
+    if (_vcas.TryGet(id, vca))
+        return vca;
+
+    // Slow path for VCAs that were not cached when their bank loaded.
+    auto result = _studioSystem->getVCAByID(&vcaGuid, &vca);
+    if (result != FMOD_OK)
+    {
+        FMODLOG(Warning, "Failed to get VCA, Error: {}", String(FMOD_ErrorString(result)));
+        return nullptr;
     }
+    _vcas[id] = vca;
+    return vca;
+}
+
+void FmodAudioSystem::SetBusMute(const String& busPath, bool mute)
+{
+    const auto bus = GetBus(busPath);
+    if (!bus)
+        return;
+    bus->setMute(mute);
+}
+
+bool FmodAudioSystem::GetBusMute(const String& busPath)
+{
+    const auto bus = GetBus(busPath);
+    if (!bus)
+        return false;
     bool mute;
     bus->getMute(&mute);
     return mute;
@@ -928,25 +2551,17 @@ bool FmodAudioSystem::GetBusMute(const String& busPath)
 
 void FmodAudioSystem::SetBusVolumeMultiplier(const String& busPath, float volumeScale)
 {
-    FMOD::Studio::Bus* bus = nullptr;
-    auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
+    const auto bus = GetBus(busPath);
+    if (!bus)
         return;
-    }
     bus->setVolume(volumeScale);
 }
 
 float FmodAudioSystem::GetBusVolumeMultiplier(const String& busPath)
 {
-    FMOD::Studio::Bus* bus = nullptr;
-    auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
+    const auto bus = GetBus(busPath);
+    if (!bus)
         return -1.0f;
-    }
     float volume;
     bus->getVolume(&volume);
     return volume;
@@ -954,25 +2569,17 @@ float FmodAudioSystem::GetBusVolumeMultiplier(const String& busPath)
 
 void FmodAudioSystem::SetBusPaused(const String& busPath, bool paused)
 {
-    FMOD::Studio::Bus* bus = nullptr;
-    auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
+    const auto bus = GetBus(busPath);
+    if (!bus)
         return;
-    }
     bus->setPaused(paused);
 }
 
 bool FmodAudioSystem::IsBusPaused(const String& busPath)
 {
-    FMOD::Studio::Bus* bus = nullptr;
-    auto result = _studioSystem->getBus(busPath.ToStringAnsi().GetText(), &bus);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get bus at {}, Error: {}", busPath, String(FMOD_ErrorString(result)));
+    const auto bus = GetBus(busPath);
+    if (!bus)
         return false;
-    }
     bool paused;
     bus->getPaused(&paused);
     return paused;
@@ -980,25 +2587,17 @@ bool FmodAudioSystem::IsBusPaused(const String& busPath)
 
 void FmodAudioSystem::SetVCAVolumeMultiplier(const String& vcaPath, float volumeScale)
 {
-    FMOD::Studio::VCA* vca = nullptr;
-    auto result = _studioSystem->getVCA(vcaPath.ToStringAnsi().GetText(), &vca);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get VCA at {}, Error: {}", vcaPath, String(FMOD_ErrorString(result)));
+    const auto vca = GetVCA(vcaPath);
+    if (!vca)
         return;
-    }
     vca->setVolume(volumeScale);
 }
 
 float FmodAudioSystem::GetVCAVolumeMultiplier(const String& vcaPath)
 {
-    FMOD::Studio::VCA* vca = nullptr;
-    auto result = _studioSystem->getVCA(vcaPath.ToStringAnsi().GetText(), &vca);
-    if (result != FMOD_OK)
-    {
-        FMODLOG(Warning, "Failed to get VCA at {}, Error: {}", vcaPath, String(FMOD_ErrorString(result)));
+    const auto vca = GetVCA(vcaPath);
+    if (!vca)
         return -1.0f;
-    }
     float volume;
     vca->getVolume(&volume);
     return volume;
@@ -1,26 +1,137 @@
 ﻿#pragma once
 
 #include "FmodAudioSettings.h"
+#include "FmodEventCallbackQueue.h"
+#include "Fmod3DAttributes.h"
 #include "fmod_studio.hpp"
+#include "Types/FmodEventMetadata.h"
+#include "Types/FmodParameterId.h"
 #include "Engine/Scripting/Plugins/GamePlugin.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Math/Vector3.h"
 
 class FmodAudioSource;
+class FmodEvent;
+class FmodBankLoadHandle;
+struct FmodBankResidency;
+class FmodBankFileData;
+
+/// <summary>
+/// A slot of the event instance slot map. Points to the dense instance data while in use.
+/// </summary>
+struct FmodEventSlot
+{
+    uint16 Generation = 1;
+    int32 DenseIndex = -1;
+};
+
+/// <summary>
+/// The 3D attributes of the moved sources gathered before they are submitted to fmod. The world transforms are gathered first and converted to fmod attributes in one batch. Indexed like the dirty sources.
+/// </summary>
+struct FmodSourceAttributes
+{
+    Array<FMOD::Studio::EventInstance*> Instances;
+    Array<FmodTransform> Transforms;
+    Array<FMOD_3D_ATTRIBUTES> Attributes;
+
+    void Resize(int32 count)
+    {
+        Instances.Resize(count, false);
+        Transforms.Resize(count, false);
+        Attributes.Resize(count, false);
+    }
+};
 
 API_CLASS() class FLAXFMOD_API FmodAudioSystem : public GamePlugin
 {
     DECLARE_SCRIPTING_TYPE(FmodAudioSystem);
+    friend class FmodBenchmark;
+    friend class FmodCapture;
 
 private:
     FMOD::Studio::System* _studioSystem = nullptr;
     FMOD::System* _coreSystem = nullptr;
     FmodAudioSettings* _settings;
-    static Dictionary<FMOD::Studio::EventInstance*, FmodAudioSource*> EventMap;
-    Dictionary<StringView, FMOD::Studio::Bank*> _loadedBanks;
+    static FmodEventCallbackQueue EventCallbacks;
+    Dictionary<String, FmodBankResidency*> _loadedBanks;
+    Array<FmodBankResidency*> _unloadingBanks;
+    Dictionary<String, FmodBankLoadHandle*> _bankLoadHandles;
+    Array<FmodBankLoadHandle*> _pendingBankLoads;
+    Array<FmodAudioSource*> _deferredSources;
     Array<uint32> _loadedPlugins;
+    Dictionary<Guid, FmodEventMetadata*> _eventMetadata;
+    Dictionary<Guid, int32> _eventWarmCounts;
+    Dictionary<uint32, FmodEventMetadata*> _eventMetadataByPath;
+    Array<FmodEventInstanceData> _eventInstances;
+    Array<FmodEventSlot> _eventSlots;
+    Array<uint16> _freeEventSlots;
+    Dictionary<String, FmodParameterId> _globalParameterIds;
+    Dictionary<Guid, FMOD::Studio::Bus*> _buses;
+    Dictionary<String, FMOD::Studio::Bus*> _busesByPath;
+    Dictionary<Guid, FMOD::Studio::VCA*> _vcas;
+    Dictionary<String, FMOD::Studio::VCA*> _vcasByPath;
+    uint32 _mixerEpoch = 1;
+    int32 _listenerCount = 1;
+    FmodSourceAttributes _sourceAttributes;
+    static constexpr int32 SourceAttributesChunkSize = 64;
+    float _listenerWeights[FMOD_MAX_LISTENERS] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    FmodTransform _listenerTransforms[FMOD_MAX_LISTENERS];
+    FMOD_3D_ATTRIBUTES _listenerAttributes[FMOD_MAX_LISTENERS];
+    Vector3 _audioOrigin = Vector3::Zero;
+    int32 _listenerTransformCount = 0;
+    bool _hasVirtualSources = false;
+
+    int64 _studioUpdateJob = 0;
+    FmodUpdateStage _updateStage = FmodUpdateStage::Update;
+    bool _manualUpdate = false;
+    double _manualTime = 0.0;
 
     void Update();
+    double GetTime() const;
+    void UpdateStudioJob(int32 index);
+    void WaitForStudioUpdate();
+    void UpdateSourceAttributes();
+    void GatherSourceAttributesJob(int32 chunkIndex);
+    void GatherSourceAttributes(int32 start, int32 end);
+    void UpdateAudioOrigin(const Vector3& listenerPosition);
+    void UpdateSourceVirtualization();
+    void VirtualizeSource(FmodAudioSource* source, const FmodEventMetadata* metadata);
+    Real GetListenerDistanceSquared(const Vector3& position) const;
+    FmodEventHandle AddEventInstance(FMOD::Studio::EventInstance* eventInstance, const FmodEventMetadata* metadata, FmodAudioSource* source);
+    void RemoveEventInstance(FmodEventHandle eventInstance);
+    FmodEventInstanceData* FindEventInstance(FmodEventHandle eventInstance);
+    FMOD::Studio::EventInstance* GetEventInstance(FmodEventHandle eventInstance);
+    FMOD::Studio::EventInstance* AcquireEventInstance(const FmodEventMetadata* metadata);
+    bool ReturnEventInstance(FMOD::Studio::EventInstance* eventInstance, const FmodEventMetadata* metadata);
+    void FillEventPool(const FmodEventMetadata* metadata);
+    void WarmEventInstances(const FmodEvent* event, const FmodEventMetadata* metadata);
+    FmodEventMetadata* AddEventMetadata(FMOD::Studio::EventDescription* eventDescription, FMOD::Studio::Bank* bank);
+    void RegisterEventPath(FmodEventMetadata* metadata);
+    void ReleaseEventMetadata(FmodEventMetadata* metadata);
+    void AddBankMetadata(FMOD::Studio::Bank* bank);
+    void ReleaseBankMetadata(FMOD::Studio::Bank* bank);
+    void AddBankMixerHandles(FMOD::Studio::Bank* bank);
+    void ReleaseMixerHandles();
+    void ReleaseAllMetadata();
+    void PlayOneShot(const FmodEventMetadata* metadata, const Vector3& position, const FmodEvent* limits = nullptr);
+    void UpdateBankLoads();
+    void DispatchEventCallbacks();
+    void CreateDeferredEventInstances();
+    void ReleaseBankLoadHandle(const StringView& bankPath);
+    String FindBankPath(const String& bankName);
+    FMOD_RESULT LoadBankFile(const StringView& bankPath, FMOD_STUDIO_LOAD_BANK_FLAGS loadFlags, FMOD::Studio::Bank** bank, FmodBankFileData** fileData);
+    FmodBankResidency* AddBankResidency(const StringView& bankPath, FMOD::Studio::Bank* bank, FmodBankFileData* fileData = nullptr);
+    void ReleaseBankResidency(FmodBankResidency* residency);
+    void UpdateUnloadingBanks();
+    FmodBankResidency* FindBankResidency(const String& bankName);
+    void AddLoadSampleDataRef(FmodBankResidency* residency);
+    void AddSampleDataRef(FmodBankResidency* residency);
+    void ReleaseSampleDataRef(FmodBankResidency* residency);
+    void RequestSampleData(FmodBankResidency* residency);
+    void TouchBank(const FmodEventMetadata* metadata);
+    void UpdateBankResidency();
 
     static FMOD_RESULT F_CALL OnSystemCallback(FMOD_SYSTEM* system, FMOD_SYSTEM_CALLBACK_TYPE type, void* commanddata1, void* commanddata2, void* userdata);
     static FMOD_RESULT F_CALL OnEventInstanceCallback(FMOD_STUDIO_EVENT_CALLBACK_TYPE type, FMOD_STUDIO_EVENTINSTANCE *event, void *parameters);
@@ -40,44 +151,86 @@ public:
     // Bank
     void LoadBank(const StringView& bankPath, int loadFlags, bool loadSampleData);
     void LoadBank(const String& bankName, bool loadSampleData);
-    void UnloadBank(const StringView& bankPath);
-    void UnloadBank(const String& bankName);
+    FmodBankLoadHandle* LoadBankAsync(const StringView& bankPath, bool loadSampleData);
+    FmodBankLoadHandle* LoadBankAsync(const String& bankName, bool loadSampleData);
+    void LoadBankMemory(const String& bankName, const byte* data, uint32 length, bool loadSampleData);
+    void UnloadBank(const StringView& bankPath, bool releaseSampleData);
+    void UnloadBank(const String& bankName, bool releaseSampleData);
     void UnloadAllBanks();
     bool IsBankLoaded(const StringView& bankPath);
     bool CheckBankLoaded(const String& bankName);
+    void LoadBankSampleData(const String& bankName);
+    void UnloadBankSampleData(const String& bankName);
+    uint64 GetBankSampleDataSize(const String& bankName);
+    uint64 GetSampleDataMemoryUsage();
 
     // Event
-    void* CreateEventInstance(const StringView& eventPath, FmodAudioSource* source);
-    void* CreateEventInstance(const FMOD_GUID& eventGuid, FmodAudioSource* source);
-    void ReleaseEventInstance(void* eventInstance);
-    void PlayEvent(void* eventInstance);
-    bool IsEventPlaying(void* eventInstance);
-    void StopEvent(void* eventInstance, int stopMode);
-    void PauseEvent(void* eventInstance, bool pause);
-    bool IsEventPaused(void* eventInstance);
-    bool IsEvent3D(void* eventInstance);
-    void SetEventVolumeMultiplier(void* eventInstance, float volumeScale);
-    void SetEventPitchMultiplier(void* eventInstance, float pitch);
-    float GetEventMinDistance(void* eventInstance);
-    float GetEventMaxDistance(void* eventInstance);
-    void SetEventMaxDistance(void* eventInstance, float maxDistance);
-    void SetEventMinDistance(void* eventInstance, float minDistance);
-    void SetEventParameter(void* eventInstance, const StringView& parameterName, float value);
-    float GetEventParameter(void* eventInstance, const StringView& parameterName);
-    float GetEventLength(void* eventInstance);
+    FmodEventHandle CreateEventInstance(const StringView& eventPath, FmodAudioSource* source);
+    FmodEventHandle CreateEventInstance(const FMOD_GUID& eventGuid, FmodAudioSource* source);
+    void ReleaseEventInstance(FmodEventHandle eventInstance);
+    bool DeferEventInstance(FmodAudioSource* source);
+    void CancelDeferredEventInstance(FmodAudioSource* source);
+    bool VirtualizeEventInstance(FmodAudioSource* source);
+    void PlayEvent(FmodEventHandle eventInstance);
+    bool IsEventPlaying(FmodEventHandle eventInstance);
+    bool IsEventStopped(FmodEventHandle eventInstance);
+    void StopEvent(FmodEventHandle eventInstance, int stopMode);
+    void PauseEvent(FmodEventHandle eventInstance, bool pause);
+    bool IsEventPaused(FmodEventHandle eventInstance);
+    bool IsEvent3D(FmodEventHandle eventInstance);
+    void SetEventVolumeMultiplier(FmodEventHandle eventInstance, float volumeScale);
+    void SetEventPitchMultiplier(FmodEventHandle eventInstance, float pitch);
+    float GetEventMinDistance(FmodEventHandle eventInstance);
+    float GetEventMaxDistance(FmodEventHandle eventInstance);
+    void SetEventMaxDistance(FmodEventHandle eventInstance, float maxDistance);
+    void SetEventMinDistance(FmodEventHandle eventInstance, float minDistance);
+    void SetEventParameter(FmodEventHandle eventInstance, const StringView& parameterName, float value);
+    float GetEventParameter(FmodEventHandle eventInstance, const StringView& parameterName);
+    FmodParameterId GetEventParameterId(FmodEventHandle eventInstance, const StringView& parameterName);
+    FmodParameterId GetEventParameterId(const FmodEventMetadata* metadata, const StringView& parameterName);
+    void SetEventParameter(FmodEventHandle eventInstance, const FmodParameterId& parameterId, float value);
+    float GetEventParameter(FmodEventHandle eventInstance, const FmodParameterId& parameterId);
+    void SetEventParameters(FmodEventHandle eventInstance, const FmodParameterId* parameterIds, const float* values, int32 count);
+    float GetEventLength(FmodEventHandle eventInstance);
     float GetEventLength(const String& eventPath);
-    float GetEventPosition(void* eventInstance);
-    void SetEventPosition(void* eventInstance, float position);
-    void RegisterEventCallback(void* eventInstance, bool marker, bool beat);
+    const FmodEventMetadata* GetEventMetadata(const StringView& eventPath);
+    const FmodEventMetadata* GetEventMetadata(const FMOD_GUID& eventGuid);
+    const FmodEventInstanceData* GetEventInstanceData(FmodEventHandle eventInstance) const;
+    float GetEventPosition(FmodEventHandle eventInstance);
+    void SetEventPosition(FmodEventHandle eventInstance, float position);
+    void RegisterEventCallback(FmodEventHandle eventInstance, bool marker, bool beat);
+    void PlayOneShot(const FMOD_GUID& eventGuid, const Vector3& position);
+    void PlayOneShot(const StringView& eventPath, const Vector3& position);
+    void PlayOneShot(const FmodEvent* event, const Vector3& position);
+
+    // Event limits
+    bool CheckEventLimits(const FmodEvent* event);
+    void ApplyEventLimits(const FmodEvent* event);
+    void AddLimitedEventInstance(const FmodEvent* event, FmodEventHandle eventInstance);
+
+    // Event pools
+    void WarmEventInstances(const FmodEvent* event);
 
     // System
     void SetDriver(int index);
     int GetDriver();
     void UpdateDrivers();
+
+    // The world position that the positions sent to fmod are relative to
+    const Vector3& GetAudioOrigin() const
+    {
+        return _audioOrigin;
+    }
     void SetGlobalParameter(const StringView& parameterName, float value);
     float GetGlobalParameter(const StringView& parameterName);
+    FmodParameterId GetGlobalParameterId(const StringView& parameterName);
+    void SetGlobalParameter(const FmodParameterId& parameterId, float value);
+    float GetGlobalParameter(const FmodParameterId& parameterId);
+    void SetGlobalParameters(const FmodParameterId* parameterIds, const float* values, int32 count);
 
     // Bus
+    FMOD::Studio::Bus* GetBus(const StringView& busPath);
+    FMOD::Studio::Bus* GetBus(const FMOD_GUID& busGuid);
     void SetBusMute(const String& busPath, bool mute);
     bool GetBusMute(const String& busPath);
     void SetBusVolumeMultiplier(const String& busPath, float volumeScale);
@@ -86,6 +239,14 @@ public:
     bool IsBusPaused(const String& busPath);
 
     // VCA
+    FMOD::Studio::VCA* GetVCA(const StringView& vcaPath);
+    FMOD::Studio::VCA* GetVCA(const FMOD_GUID& vcaGuid);
+
+    // Changes whenever cached bus and VCA handles may be stale
+    uint32 GetMixerEpoch() const
+    {
+        return _mixerEpoch;
+    }
     void SetVCAVolumeMultiplier(const String& vcaPath, float volumeScale);
     float GetVCAVolumeMultiplier(const String& vcaPath);
 };
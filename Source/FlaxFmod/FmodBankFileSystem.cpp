@@ -0,0 +1,164 @@
+﻿#include "FmodBankFileSystem.h"
+
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#if PLATFORM_WINDOWS
+#include "Engine/Platform/Win32/IncludeWindowsHeaders.h"
+#elif PLATFORM_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+FmodBankFileData::~FmodBankFileData()
+{
+    if (_mapped)
+    {
+#if PLATFORM_WINDOWS
+        UnmapViewOfFile(_data);
+        CloseHandle(_mappingHandle);
+        CloseHandle(_fileHandle);
+#elif PLATFORM_UNIX
+        munmap(_data, _size);
+#endif
+    }
+    else if (_data)
+    {
+        Allocator::Free(_data);
+    }
+}
+
+FmodBankFileData* FmodBankFileData::Open(const StringView& path)
+{
+    auto fileData = New<FmodBankFileData>();
+#if PLATFORM_WINDOWS
+    const String pathStr(path);
+    HANDLE fileHandle = CreateFileW(pathStr.Get(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER size;
+        HANDLE mappingHandle = nullptr;
+        if (GetFileSizeEx(fileHandle, &size) && size.QuadPart > 0 && size.QuadPart <= MAX_uint32)
+            mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* data = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (data)
+        {
+            fileData->_data = static_cast<byte*>(data);
+            fileData->_size = static_cast<uint32>(size.QuadPart);
+            fileData->_mapped = true;
+            fileData->_fileHandle = fileHandle;
+            fileData->_mappingHandle = mappingHandle;
+            return fileData;
+        }
+        if (mappingHandle)
+            CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+    }
+#elif PLATFORM_UNIX
+    const int fd = open(path.ToStringAnsi().GetText(), O_RDONLY);
+    if (fd != -1)
+    {
+        struct stat fileStat;
+        void* data = MAP_FAILED;
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0 && fileStat.st_size <= MAX_uint32)
+            data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping stays valid after the descriptor is closed.
+        close(fd);
+        if (data != MAP_FAILED)
+        {
+            fileData->_data = static_cast<byte*>(data);
+            fileData->_size = static_cast<uint32>(fileStat.st_size);
+            fileData->_mapped = true;
+            return fileData;
+        }
+    }
+#endif
+
+    // Fallback to reading the whole file into memory aligned for fmod.
+    auto file = File::Open(path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (file)
+    {
+        const uint32 size = file->GetSize();
+        fileData->_data = static_cast<byte*>(Allocator::Allocate(size, FMOD_STUDIO_LOAD_MEMORY_ALIGNMENT));
+        fileData->_size = size;
+        uint32 bytesRead = 0;
+        const bool failed = file->Read(fileData->_data, size, &bytesRead) || bytesRead != size;
+        Delete(file);
+        if (!failed)
+            return fileData;
+    }
+    Delete(fileData);
+    return nullptr;
+}
+
+FMOD_RESULT FmodBankFileSystem::LoadBankCustom(FMOD::Studio::System* system, const StringView& path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank)
+{
+    // Fmod copies the user data so the path stays valid for asynchronous loads.
+    const String pathStr(path);
+    FMOD_STUDIO_BANK_INFO info = {};
+    info.size = sizeof(FMOD_STUDIO_BANK_INFO);
+    info.userdata = (void*)pathStr.Get();
+    info.userdatalength = (pathStr.Length() + 1) * sizeof(Char);
+    info.opencallback = OnFileOpen;
+    info.closecallback = OnFileClose;
+    info.readcallback = OnFileRead;
+    info.seekcallback = OnFileSeek;
+    return system->loadBankCustom(&info, flags, bank);
+}
+
+FMOD_RESULT FmodBankFileSystem::LoadBankMapped(FMOD::Studio::System* system, const StringView& path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank, FmodBankFileData** fileData)
+{
+    *fileData = FmodBankFileData::Open(path);
+    if (!*fileData)
+        return FMOD_ERR_FILE_NOTFOUND;
+    const auto result = LoadBankMemory(system, (*fileData)->GetData(), (*fileData)->GetSize(), flags, bank);
+    if (result != FMOD_OK)
+    {
+        Delete(*fileData);
+        *fileData = nullptr;
+    }
+    return result;
+}
+
+FMOD_RESULT FmodBankFileSystem::LoadBankMemory(FMOD::Studio::System* system, const byte* data, uint32 length, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank)
+{
+    // Fmod can only use the memory in place if it is aligned.
+    const bool aligned = (reinterpret_cast<uintptr>(data) & (FMOD_STUDIO_LOAD_MEMORY_ALIGNMENT - 1)) == 0;
+    const auto mode = aligned ? FMOD_STUDIO_LOAD_MEMORY_POINT : FMOD_STUDIO_LOAD_MEMORY;
+    return system->loadBankMemory(reinterpret_cast<const char*>(data), static_cast<int>(length), mode, flags, bank);
+}
+
+FMOD_RESULT FmodBankFileSystem::OnFileOpen(const char* name, unsigned int* fileSize, void** handle, void* userData)
+{
+    const auto path = static_cast<const Char*>(userData);
+    auto file = File::Open(StringView(path), FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (!file)
+        return FMOD_ERR_FILE_NOTFOUND;
+    *fileSize = file->GetSize();
+    *handle = file;
+    return FMOD_OK;
+}
+
+FMOD_RESULT FmodBankFileSystem::OnFileClose(void* handle, void* userData)
+{
+    Delete(static_cast<File*>(handle));
+    return FMOD_OK;
+}
+
+FMOD_RESULT FmodBankFileSystem::OnFileRead(void* handle, void* buffer, unsigned int sizeBytes, unsigned int* bytesRead, void* userData)
+{
+    uint32 read = 0;
+    if (static_cast<File*>(handle)->Read(buffer, sizeBytes, &read))
+        return FMOD_ERR_FILE_BAD;
+    *bytesRead = read;
+    return read < sizeBytes ? FMOD_ERR_FILE_EOF : FMOD_OK;
+}
+
+FMOD_RESULT FmodBankFileSystem::OnFileSeek(void* handle, unsigned int position, void* userData)
+{
+    static_cast<File*>(handle)->SetPosition(position);
+    return FMOD_OK;
+}
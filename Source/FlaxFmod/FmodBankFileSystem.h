@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "fmod_studio.hpp"
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+
+/// <summary>
+/// Read-only bank file data that stays valid until the bank is unloaded. Memory mapped where the platform supports it, otherwise read into an aligned buffer.
+/// </summary>
+class FmodBankFileData
+{
+private:
+    byte* _data = nullptr;
+    uint32 _size = 0;
+    bool _mapped = false;
+#if PLATFORM_WINDOWS
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+
+public:
+    ~FmodBankFileData();
+
+    /// <summary>
+    /// Opens the bank file data. Returns null if the file could not be opened.
+    /// </summary>
+    static FmodBankFileData* Open(const StringView& path);
+
+    const byte* GetData() const
+    {
+        return _data;
+    }
+
+    uint32 GetSize() const
+    {
+        return _size;
+    }
+
+    bool IsMapped() const
+    {
+        return _mapped;
+    }
+};
+
+/// <summary>
+/// Loads fmod banks through Flax's file system instead of fmod's own file access.
+/// </summary>
+class FmodBankFileSystem
+{
+public:
+    /// <summary>
+    /// Loads a bank with loadBankCustom, reading the file with Flax's file API.
+    /// </summary>
+    static FMOD_RESULT LoadBankCustom(FMOD::Studio::System* system, const StringView& path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank);
+
+    /// <summary>
+    /// Loads a bank from a memory mapped file. The file data must be kept until the bank is unloaded.
+    /// </summary>
+    static FMOD_RESULT LoadBankMapped(FMOD::Studio::System* system, const StringView& path, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank, FmodBankFileData** fileData);
+
+    /// <summary>
+    /// Loads a bank from memory. Aligned memory is used in place and must be kept until the bank is unloaded, otherwise it is copied by fmod.
+    /// </summary>
+    static FMOD_RESULT LoadBankMemory(FMOD::Studio::System* system, const byte* data, uint32 length, FMOD_STUDIO_LOAD_BANK_FLAGS flags, FMOD::Studio::Bank** bank);
+
+private:
+    static FMOD_RESULT F_CALL OnFileOpen(const char* name, unsigned int* fileSize, void** handle, void* userData);
+    static FMOD_RESULT F_CALL OnFileClose(void* handle, void* userData);
+    static FMOD_RESULT F_CALL OnFileRead(void* handle, void* buffer, unsigned int sizeBytes, unsigned int* bytesRead, void* userData);
+    static FMOD_RESULT F_CALL OnFileSeek(void* handle, unsigned int position, void* userData);
+};
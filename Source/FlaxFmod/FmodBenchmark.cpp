@@ -0,0 +1,172 @@
+﻿#include "FmodBenchmark.h"
+
+#include "FmodAudio.h"
+#include "FmodAudioSystem.h"
+#include "Actors/FmodAudioSource.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Platform/Platform.h"
+
+namespace
+{
+    FmodBenchmarkPercentiles GetPercentiles(Array<float>& samples)
+    {
+        FmodBenchmarkPercentiles result;
+        if (samples.IsEmpty())
+            return result;
+        Sorting::QuickSort(samples.Get(), samples.Count());
+        const int32 last = samples.Count() - 1;
+        result.P50 = samples[Math::Min(last, samples.Count() * 50 / 100)];
+        result.P90 = samples[Math::Min(last, samples.Count() * 90 / 100)];
+        result.P99 = samples[Math::Min(last, samples.Count() * 99 / 100)];
+        result.Max = samples[last];
+        return result;
+    }
+}
+
+FmodBenchmarkResult FmodBenchmark::Run(const FmodBenchmarkOptions& options)
+{
+    FmodBenchmarkResult result;
+    FmodAudioSystem* audioSystem = FmodAudio::GetAudioSystem();
+    if (!audioSystem || !audioSystem->_studioSystem)
+    {
+        FMODLOG(Warning, "Cannot run the benchmark. The audio system is not initialized.");
+        return result;
+    }
+    if (options.SourceCount > 0 && options.SourceEvent && Level::Scenes.IsEmpty())
+    {
+        FMODLOG(Warning, "Cannot run the benchmark. Sources need a loaded scene.");
+        return result;
+    }
+
+    // A real device mixes on its own clock, so the mixer cost is not tied to the updates and runs are not comparable.
+    FMOD_OUTPUTTYPE outputType = FMOD_OUTPUTTYPE_AUTODETECT;
+    if (audioSystem->_coreSystem->getOutput(&outputType) == FMOD_OK && outputType != FMOD_OUTPUTTYPE_NOSOUND_NRT)
+        FMODLOG(Warning, "The benchmark runs against an audio device. Use the NoSoundNrt output type for comparable results.");
+
+    // Let pending work settle so it is not measured.
+    audioSystem->WaitForStudioUpdate();
+
+    Array<FmodAudioSource*> sources;
+    if (options.SourceEvent)
+    {
+        sources.EnsureCapacity(options.SourceCount);
+        for (int32 i = 0; i < options.SourceCount; i++)
+        {
+            auto source = New<FmodAudioSource>();
+            source->HideFlags = HideFlags::FullyHidden;
+            source->Event = options.SourceEvent;
+            Level::SpawnActor(source);
+            source->Play();
+            sources.Add(source);
+        }
+    }
+
+    // Sources out of listener range are virtual and have no instance, so the id comes from the event description.
+    FmodParameterId parameterId;
+    if (sources.HasItems() && options.ParameterName.HasChars())
+    {
+        const auto sourceEvent = options.SourceEvent.GetInstance();
+        if (sourceEvent)
+        {
+            const auto metadata = sourceEvent->Guid.HasChars() ? audioSystem->GetEventMetadata(sourceEvent->GetFmodGuid()) : audioSystem->GetEventMetadata(sourceEvent->Path);
+            parameterId = audioSystem->GetEventParameterId(metadata, options.ParameterName);
+        }
+        if (!parameterId.IsValid())
+            FMODLOG(Warning, "Benchmark source event has no parameter {}. Parameter writes are skipped.", options.ParameterName);
+    }
+
+    const bool cycleBank = options.CycledBankName.HasChars();
+    const bool bankWasLoaded = cycleBank && FmodAudio::IsBankLoaded(options.CycledBankName);
+
+    Array<float> updateTimes, mixerCpu, studioCpu;
+    updateTimes.EnsureCapacity(options.Frames);
+    mixerCpu.EnsureCapacity(options.Frames);
+    studioCpu.EnsureCapacity(options.Frames);
+
+    int32 parameterCursor = 0;
+    int64 liveParameterWrites = 0;
+    for (int32 frame = 0; frame < options.Frames; frame++)
+    {
+        const float time = frame * options.DeltaTime;
+
+        // Every source moves along its own circle.
+        for (int32 i = 0; i < sources.Count(); i++)
+        {
+            const float angle = time + i * 0.618034f * PI * 2.0f;
+            const Vector3 center((i % 32) * options.SourceRadius, 0.0f, (i / 32) * options.SourceRadius);
+            sources[i]->SetPosition(center + Vector3(Math::Cos(angle), 0.0f, Math::Sin(angle)) * options.SourceRadius);
+        }
+
+        if (parameterId.IsValid())
+        {
+            for (int32 i = 0; i < options.ParameterWritesPerFrame; i++)
+            {
+                const auto source = sources[parameterCursor];
+                if (audioSystem->FindEventInstance(source->EventInstance))
+                    liveParameterWrites++;
+                source->SetParameter(parameterId, Math::Sin(time + i * 0.01f) * 0.5f + 0.5f);
+                parameterCursor = (parameterCursor + 1) % sources.Count();
+            }
+        }
+
+        if (options.OneShotEvent)
+        {
+            for (int32 i = 0; i < options.OneShotsPerFrame; i++)
+            {
+                const float angle = (frame * options.OneShotsPerFrame + i) * 0.618034f * PI * 2.0f;
+                FmodAudio::PlayEventAtLocation(options.OneShotEvent, Vector3(Math::Cos(angle), 0.0f, Math::Sin(angle)) * options.SourceRadius);
+            }
+        }
+
+        if (cycleBank && frame % options.BankCycleInterval == 0)
+        {
+            if (FmodAudio::IsBankLoaded(options.CycledBankName))
+                FmodAudio::UnloadBank(options.CycledBankName);
+            else
+                FmodAudio::LoadBank(options.CycledBankName, true);
+        }
+
+        const double startTime = Platform::GetTimeSeconds();
+        audioSystem->Update();
+        audioSystem->WaitForStudioUpdate();
+        updateTimes.Add(static_cast<float>((Platform::GetTimeSeconds() - startTime) * 1000.0));
+
+        FMOD_STUDIO_CPU_USAGE studioUsage;
+        FMOD_CPU_USAGE coreUsage;
+        if (audioSystem->_studioSystem->getCPUUsage(&studioUsage, &coreUsage) == FMOD_OK)
+        {
+            mixerCpu.Add(coreUsage.dsp);
+            studioCpu.Add(studioUsage.update);
+        }
+    }
+
+    // Restore the cycled bank so the run leaves the loaded banks as it found them.
+    if (cycleBank && FmodAudio::IsBankLoaded(options.CycledBankName) != bankWasLoaded)
+    {
+        if (bankWasLoaded)
+            FmodAudio::LoadBank(options.CycledBankName, true);
+        else
+            FmodAudio::UnloadBank(options.CycledBankName);
+    }
+    int32 liveSources = 0;
+    for (auto source : sources)
+    {
+        if (audioSystem->FindEventInstance(source->EventInstance))
+            liveSources++;
+        source->Stop();
+        source->DeleteObject();
+    }
+
+    result.Frames = updateTimes.Count();
+    result.LiveSources = liveSources;
+    result.LiveParameterWrites = liveParameterWrites;
+    result.UpdateTime = GetPercentiles(updateTimes);
+    result.MixerCpu = GetPercentiles(mixerCpu);
+    result.StudioCpu = GetPercentiles(studioCpu);
+    FMODLOG(Info, "Benchmark: {} frames, {} of {} sources live, {} parameter writes to live sources, update p50 {}ms p90 {}ms p99 {}ms max {}ms, mixer cpu p50 {}% p99 {}%, studio cpu p50 {}% p99 {}%",
+            result.Frames, result.LiveSources, sources.Count(), result.LiveParameterWrites, result.UpdateTime.P50, result.UpdateTime.P90, result.UpdateTime.P99, result.UpdateTime.Max,
+            result.MixerCpu.P50, result.MixerCpu.P99, result.StudioCpu.P50, result.StudioCpu.P99);
+    return result;
+}
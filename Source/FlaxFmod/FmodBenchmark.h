@@ -0,0 +1,154 @@
+﻿#pragma once
+
+#include "Assets/FmodEvent.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Content/JsonAssetReference.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The options of an fmod benchmark run.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodBenchmarkOptions
+{
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodBenchmarkOptions);
+public:
+
+    /// <summary>
+    /// The number of frames to run.
+    /// </summary>
+    API_FIELD(Attributes="Limit(1)") int32 Frames = 600;
+
+    /// <summary>
+    /// The simulated frame time in seconds. Moves the sources and is the time between bank cycles.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.0001f)") float DeltaTime = 1.0f / 60.0f;
+
+    /// <summary>
+    /// The looping 3D event played by the moving sources.
+    /// </summary>
+    API_FIELD() JsonAssetReference<FmodEvent> SourceEvent;
+
+    /// <summary>
+    /// The number of moving 3D sources to spawn.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") int32 SourceCount = 1000;
+
+    /// <summary>
+    /// The radius of the circles the sources move along.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") float SourceRadius = 5000.0f;
+
+    /// <summary>
+    /// The parameter of the source event written each frame. Leave empty to skip parameter writes.
+    /// </summary>
+    API_FIELD() String ParameterName;
+
+    /// <summary>
+    /// The number of source parameter writes per frame, spread over the sources.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") int32 ParameterWritesPerFrame = 1000;
+
+    /// <summary>
+    /// The event fired as one-shots.
+    /// </summary>
+    API_FIELD() JsonAssetReference<FmodEvent> OneShotEvent;
+
+    /// <summary>
+    /// The number of one-shots fired per frame.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") int32 OneShotsPerFrame = 10;
+
+    /// <summary>
+    /// The bank loaded and unloaded during the run. Should not hold the source or one-shot events. Leave empty to skip bank cycles.
+    /// </summary>
+    API_FIELD() String CycledBankName;
+
+    /// <summary>
+    /// The number of frames between bank loads and unloads.
+    /// </summary>
+    API_FIELD(Attributes="Limit(1)") int32 BankCycleInterval = 30;
+};
+
+/// <summary>
+/// The percentiles of a per-frame benchmark measurement.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodBenchmarkPercentiles
+{
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodBenchmarkPercentiles);
+public:
+
+    /// <summary>
+    /// The median.
+    /// </summary>
+    API_FIELD() float P50 = 0.0f;
+
+    /// <summary>
+    /// The 90th percentile.
+    /// </summary>
+    API_FIELD() float P90 = 0.0f;
+
+    /// <summary>
+    /// The 99th percentile.
+    /// </summary>
+    API_FIELD() float P99 = 0.0f;
+
+    /// <summary>
+    /// The largest sample.
+    /// </summary>
+    API_FIELD() float Max = 0.0f;
+};
+
+/// <summary>
+/// The results of an fmod benchmark run.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodBenchmarkResult
+{
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodBenchmarkResult);
+public:
+
+    /// <summary>
+    /// The number of measured frames.
+    /// </summary>
+    API_FIELD() int32 Frames = 0;
+
+    /// <summary>
+    /// The number of sources with an event instance at the end of the run. Sources out of listener range are virtual and have none.
+    /// </summary>
+    API_FIELD() int32 LiveSources = 0;
+
+    /// <summary>
+    /// The number of parameter writes that reached an event instance. Writes to virtual sources are only cached on the source.
+    /// </summary>
+    API_FIELD() int64 LiveParameterWrites = 0;
+
+    /// <summary>
+    /// The time spent in the audio system update in milliseconds, including the studio update when it runs on a job.
+    /// </summary>
+    API_FIELD() FmodBenchmarkPercentiles UpdateTime;
+
+    /// <summary>
+    /// The fmod mixer CPU usage in percent.
+    /// </summary>
+    API_FIELD() FmodBenchmarkPercentiles MixerCpu;
+
+    /// <summary>
+    /// The fmod studio update CPU usage in percent.
+    /// </summary>
+    API_FIELD() FmodBenchmarkPercentiles StudioCpu;
+};
+
+/// <summary>
+/// Runs synthetic workloads through the fmod audio system and measures the update cost. Meant for headless runs with the NoSoundNrt output type, where fmod mixes on each update without an audio device.
+/// </summary>
+API_CLASS(Static) class FLAXFMOD_API FmodBenchmark
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(FmodBenchmark);
+
+public:
+    /// <summary>
+    /// Runs the benchmark on the calling thread. Updates the audio system directly, so call it from the main thread outside of the audio system update. Needs a loaded scene to spawn the sources into.
+    /// </summary>
+    /// <param name="options">The benchmark workload.</param>
+    /// <returns>The measured results.</returns>
+    API_FUNCTION() static FmodBenchmarkResult Run(const FmodBenchmarkOptions& options);
+};
@@ -0,0 +1,81 @@
+﻿#include "FmodCapture.h"
+
+#include "FmodAudio.h"
+#include "FmodAudioSystem.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+
+bool FmodCapture::IsAvailable()
+{
+    const FmodAudioSystem* audioSystem = FmodAudio::GetAudioSystem();
+    return audioSystem && audioSystem->_studioSystem && audioSystem->_manualUpdate;
+}
+
+bool FmodCapture::Render(const FmodCaptureScenario& scenario)
+{
+    if (!IsAvailable())
+    {
+        FMODLOG(Warning, "Cannot render the capture scenario. The audio system was not initialized with the WavWriterNrt output type.");
+        return false;
+    }
+    FmodAudioSystem* audioSystem = FmodAudio::GetAudioSystem();
+
+    // Each step mixes one DSP buffer, so the clock advances by the buffer length.
+    unsigned int bufferLength = 0;
+    int bufferCount = 0, sampleRate = 0, rawSpeakers = 0;
+    FMOD_SPEAKERMODE speakerMode;
+    audioSystem->_coreSystem->getDSPBufferSize(&bufferLength, &bufferCount);
+    audioSystem->_coreSystem->getSoftwareFormat(&sampleRate, &speakerMode, &rawSpeakers);
+    if (bufferLength == 0 || sampleRate <= 0)
+    {
+        FMODLOG(Warning, "Cannot render the capture scenario. Failed to get the Fmod mixer format.");
+        return false;
+    }
+    const double stepTime = static_cast<double>(bufferLength) / sampleRate;
+    const int32 stepCount = static_cast<int32>(Math::Ceil(scenario.Duration / stepTime));
+
+    const double startTime = audioSystem->_manualTime;
+    int32 commandIndex = 0;
+    for (int32 step = 0; step < stepCount; step++)
+    {
+        const double time = step * stepTime;
+        audioSystem->_manualTime = startTime + time;
+
+        while (commandIndex < scenario.Commands.Count() && scenario.Commands[commandIndex].Time <= time)
+        {
+            const auto& command = scenario.Commands[commandIndex++];
+            switch (command.Type)
+            {
+            case FmodCaptureCommandType::PlayOneShot:
+                FmodAudio::PlayEventAtLocation(command.Event, command.Position);
+                break;
+            case FmodCaptureCommandType::SetGlobalParameter:
+                FmodAudio::SetGlobalParameter(command.Name, command.Value);
+                break;
+            case FmodCaptureCommandType::SetListener:
+            {
+                FMOD_3D_ATTRIBUTES attributes = {};
+                attributes.position = Fmod3DAttributes::ToFmodVector(command.Position, audioSystem->GetAudioOrigin());
+                attributes.forward = Fmod3DAttributes::ToFmodVector(Vector3::Forward, Vector3::Zero);
+                attributes.up = Fmod3DAttributes::ToFmodVector(Vector3::Up, Vector3::Zero);
+                audioSystem->_studioSystem->setListenerAttributes(0, &attributes);
+                break;
+            }
+            case FmodCaptureCommandType::LoadBank:
+                FmodAudio::LoadBank(command.Name, true);
+                break;
+            case FmodCaptureCommandType::UnloadBank:
+                FmodAudio::UnloadBank(command.Name);
+                break;
+            }
+        }
+
+        audioSystem->Update();
+    }
+    audioSystem->_manualTime = startTime + stepCount * stepTime;
+
+    FMODLOG(Info, "Rendered capture scenario: {} steps of {} samples at {} Hz.", stepCount, bufferLength, sampleRate);
+    if (scenario.ExitWhenDone)
+        Engine::RequestExit();
+    return true;
+}
@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#include "Assets/FmodEvent.h"
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Content/JsonAssetReference.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The action of a capture scenario command.
+/// </summary>
+API_ENUM() enum class FmodCaptureCommandType
+{
+    /// <summary>
+    /// Plays the event as a one-shot at the position.
+    /// </summary>
+    PlayOneShot,
+
+    /// <summary>
+    /// Sets the global parameter with the name to the value.
+    /// </summary>
+    SetGlobalParameter,
+
+    /// <summary>
+    /// Moves the first listener to the position. Ignored when the scene has enabled listeners, since they are sent on each step.
+    /// </summary>
+    SetListener,
+
+    /// <summary>
+    /// Loads the bank with the name and its sample data.
+    /// </summary>
+    LoadBank,
+
+    /// <summary>
+    /// Unloads the bank with the name.
+    /// </summary>
+    UnloadBank,
+};
+
+/// <summary>
+/// A timed command of a capture scenario.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodCaptureCommand : public ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodCaptureCommand);
+public:
+
+    /// <summary>
+    /// The simulated time in seconds from the start of the render when the command runs.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") float Time = 0.0f;
+
+    /// <summary>
+    /// The action of the command.
+    /// </summary>
+    API_FIELD() FmodCaptureCommandType Type = FmodCaptureCommandType::PlayOneShot;
+
+    /// <summary>
+    /// The event played by PlayOneShot.
+    /// </summary>
+    API_FIELD() JsonAssetReference<FmodEvent> Event;
+
+    /// <summary>
+    /// The parameter name of SetGlobalParameter, or the bank name of LoadBank and UnloadBank.
+    /// </summary>
+    API_FIELD() String Name;
+
+    /// <summary>
+    /// The parameter value of SetGlobalParameter.
+    /// </summary>
+    API_FIELD() float Value = 0.0f;
+
+    /// <summary>
+    /// The world position of PlayOneShot and SetListener.
+    /// </summary>
+    API_FIELD() Vector3 Position = Vector3::Zero;
+};
+
+/// <summary>
+/// A scripted sequence of audio commands rendered offline by FmodCapture.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodCaptureScenario : public ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodCaptureScenario);
+public:
+
+    /// <summary>
+    /// The length of the render in simulated seconds.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") float Duration = 10.0f;
+
+    /// <summary>
+    /// The commands, ordered by time. Commands with the same time run in the list order.
+    /// </summary>
+    API_FIELD() Array<FmodCaptureCommand> Commands;
+
+    /// <summary>
+    /// Whether to request the engine exit after the render. Fmod completes the wav file when the audio system is deinitialized.
+    /// </summary>
+    API_FIELD() bool ExitWhenDone = false;
+};
+
+/// <summary>
+/// Renders scripted scenarios to a wav file without an audio device. The audio system is stepped one mixer block at a time on a simulated clock, so the same scenario and banks give the same file and can be diffed against a golden reference.
+/// Needs the WavWriterNrt output type in the init settings, which also stops the scripts from updating the audio system.
+/// </summary>
+API_CLASS(Static) class FLAXFMOD_API FmodCapture
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(FmodCapture);
+
+public:
+    /// <summary>
+    /// Returns true if the audio system was initialized for offline renders.
+    /// </summary>
+    API_PROPERTY() static bool IsAvailable();
+
+    /// <summary>
+    /// Renders the scenario to the wav file. Consecutive renders are appended to the same file.
+    /// </summary>
+    /// <param name="scenario">The scenario to render.</param>
+    /// <returns>True if the scenario was rendered, false if offline renders are not available.</returns>
+    API_FUNCTION() static bool Render(const FmodCaptureScenario& scenario);
+};
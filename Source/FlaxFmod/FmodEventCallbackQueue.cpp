@@ -0,0 +1,153 @@
+﻿#include "FmodEventCallbackQueue.h"
+
+#include "FmodAudio.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/StringUtils.h"
+
+FmodEventCallbackQueue::FmodEventCallbackQueue()
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+    static_assert((MarkerNameCapacity & (MarkerNameCapacity - 1)) == 0, "MarkerNameCapacity must be a power of two.");
+    for (int32 i = 0; i < Capacity; i++)
+        _cells[i].Sequence = i;
+    Platform::MemoryClear(_markerNames, sizeof(_markerNames));
+    _markerNameStrings.Resize(MarkerNameCapacity);
+}
+
+FmodEventCallbackQueue::~FmodEventCallbackQueue()
+{
+    for (auto name : _overflowNames)
+        Delete(name);
+}
+
+bool FmodEventCallbackQueue::Enqueue(const FmodEventCallbackRecord& record)
+{
+    // Producers claim a cell by advancing the enqueue position, the cell sequence tells if it was consumed.
+    int64 position = Platform::AtomicRead(&_enqueuePosition);
+    Cell* cell;
+    for (;;)
+    {
+        cell = &_cells[position & (Capacity - 1)];
+        const int64 sequence = Platform::AtomicRead(&cell->Sequence);
+        const int64 diff = sequence - position;
+        if (diff == 0)
+        {
+            const int64 previous = Platform::InterlockedCompareExchange(&_enqueuePosition, position + 1, position);
+            if (previous == position)
+                break;
+            position = previous;
+        }
+        else if (diff < 0)
+        {
+            Platform::InterlockedIncrement(&_droppedCount);
+            return false;
+        }
+        else
+        {
+            position = Platform::AtomicRead(&_enqueuePosition);
+        }
+    }
+
+    cell->Record = record;
+    Platform::AtomicStore(&cell->Sequence, position + 1);
+    return true;
+}
+
+bool FmodEventCallbackQueue::Dequeue(FmodEventCallbackRecord& record)
+{
+    Cell& cell = _cells[_dequeuePosition & (Capacity - 1)];
+    if (Platform::AtomicRead(&cell.Sequence) != _dequeuePosition + 1)
+        return false;
+
+    record = cell.Record;
+
+    // Release the cell for the next lap of producers.
+    Platform::AtomicStore(&cell.Sequence, _dequeuePosition + Capacity);
+    _dequeuePosition++;
+    return true;
+}
+
+int32 FmodEventCallbackQueue::InternMarkerName(const char* name)
+{
+    if (!name)
+        name = "";
+
+    // FNV-1a over the stored part of the name. Zero marks an empty slot.
+    uint32 hash = 2166136261u;
+    int32 length = 0;
+    while (name[length] && length < MarkerNameLength - 1)
+    {
+        hash = (hash ^ static_cast<byte>(name[length])) * 16777619u;
+        length++;
+    }
+    if (name[length])
+        return InternOverflowMarkerName(name);
+    if (hash == 0)
+        hash = 1;
+
+    for (int32 i = 0; i < MarkerNameCapacity; i++)
+    {
+        const int32 index = static_cast<int32>((hash + i) & (MarkerNameCapacity - 1));
+        MarkerName& entry = _markerNames[index];
+        int64 entryHash = Platform::AtomicRead(&entry.Hash);
+        if (entryHash == 0)
+        {
+            entryHash = Platform::InterlockedCompareExchange(&entry.Hash, hash, 0);
+            if (entryHash == 0)
+            {
+                Platform::MemoryCopy(entry.Name, name, length);
+                entry.Name[length] = 0;
+                Platform::AtomicStore(&entry.Ready, 1);
+                return index;
+            }
+        }
+        if (entryHash != hash)
+            continue;
+
+        // Another thread may still be copying the name in.
+        while (Platform::AtomicRead(&entry.Ready) == 0)
+            Platform::Yield();
+        if (StringUtils::Compare(entry.Name, name, length) == 0 && entry.Name[length] == 0)
+            return index;
+    }
+    return InternOverflowMarkerName(name);
+}
+
+int32 FmodEventCallbackQueue::InternOverflowMarkerName(const char* name)
+{
+    ScopeLock lock(_overflowLocker);
+    for (int32 i = 0; i < _overflowKeys.Count(); i++)
+    {
+        if (StringUtils::Compare(_overflowKeys[i].Get(), name) == 0)
+            return MarkerNameCapacity + i;
+    }
+    _overflowKeys.Add(StringAnsi(name));
+    _overflowNames.Add(New<String>(name));
+    return MarkerNameCapacity + _overflowNames.Count() - 1;
+}
+
+const String& FmodEventCallbackQueue::GetMarkerName(int32 id)
+{
+    if (id < 0)
+        return String::Empty;
+    if (id >= MarkerNameCapacity)
+    {
+        ScopeLock lock(_overflowLocker);
+        if (!_overflowLogged)
+        {
+            _overflowLogged = true;
+            FMODLOG(Warning, "Marker name table is full or a marker name is longer than {} characters. Extra marker names are stored on the heap.", MarkerNameLength - 1);
+        }
+        id -= MarkerNameCapacity;
+        return id < _overflowNames.Count() ? *_overflowNames[id] : String::Empty;
+    }
+    auto& name = _markerNameStrings[id];
+    if (name.IsEmpty() && _markerNames[id].Name[0] != 0)
+        name = String(_markerNames[id].Name);
+    return name;
+}
+
+int64 FmodEventCallbackQueue::PopDroppedCount()
+{
+    return Platform::InterlockedExchange(&_droppedCount, 0);
+}
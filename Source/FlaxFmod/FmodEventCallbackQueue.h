@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#include "fmod_studio.hpp"
+#include "Types/FmodEventHandle.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Platform/CriticalSection.h"
+
+/// <summary>
+/// A compact copy of an event instance callback that can be passed between threads.
+/// </summary>
+struct FmodEventCallbackRecord
+{
+    FMOD::Studio::EventInstance* Instance;
+    FmodEventHandle Handle;
+    FMOD_STUDIO_EVENT_CALLBACK_TYPE Type;
+
+    // Beat: beat, bar, position. Marker: interned name id, position.
+    int32 Values[3];
+    float Tempo;
+};
+
+/// <summary>
+/// A bounded lock-free queue used to pass event instance callbacks from fmod's threads to the game thread.
+/// Any thread can enqueue, only the game thread can dequeue.
+/// </summary>
+class FmodEventCallbackQueue
+{
+public:
+    static constexpr int32 Capacity = 1024;
+    static constexpr int32 MarkerNameCapacity = 256;
+    static constexpr int32 MarkerNameLength = 64;
+
+private:
+    struct Cell
+    {
+        volatile int64 Sequence;
+        FmodEventCallbackRecord Record;
+    };
+
+    struct MarkerName
+    {
+        volatile int64 Hash;
+        volatile int64 Ready;
+        char Name[MarkerNameLength];
+    };
+
+    Cell _cells[Capacity];
+    byte _padding0[64];
+    volatile int64 _enqueuePosition = 0;
+    byte _padding1[64];
+    int64 _dequeuePosition = 0;
+    volatile int64 _droppedCount = 0;
+    MarkerName _markerNames[MarkerNameCapacity];
+    Array<String> _markerNameStrings;
+
+    // Names that don't fit the table. Rare, so a lock is fine. Strings are heap allocated to keep returned references valid.
+    CriticalSection _overflowLocker;
+    Array<StringAnsi> _overflowKeys;
+    Array<String*> _overflowNames;
+    bool _overflowLogged = false;
+
+    int32 InternOverflowMarkerName(const char* name);
+
+public:
+    FmodEventCallbackQueue();
+    ~FmodEventCallbackQueue();
+
+    /// <summary>
+    /// Adds a record to the queue. Safe to call from any thread. Returns false and counts the record as dropped if the queue is full.
+    /// </summary>
+    bool Enqueue(const FmodEventCallbackRecord& record);
+
+    /// <summary>
+    /// Removes the oldest record from the queue. Only call from the game thread.
+    /// </summary>
+    bool Dequeue(FmodEventCallbackRecord& record);
+
+    /// <summary>
+    /// Gets the id of a marker name, adding it to the table if needed. Safe to call from any thread. Names that are too long or don't fit the full table are interned on the heap instead.
+    /// </summary>
+    int32 InternMarkerName(const char* name);
+
+    /// <summary>
+    /// Gets the marker name for an interned id. Only call from the game thread.
+    /// </summary>
+    const String& GetMarkerName(int32 id);
+
+    /// <summary>
+    /// Gets the number of records dropped since the last call and resets it.
+    /// </summary>
+    int64 PopDroppedCount();
+};
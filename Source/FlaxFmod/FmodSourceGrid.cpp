@@ -0,0 +1,217 @@
+﻿#include "FmodSourceGrid.h"
+
+#include "Actors/FmodAudioSource.h"
+#include "Engine/Core/Collections/Sorting.h"
+
+// Cell coordinates are packed into 21 bits per axis.
+#define GRID_COORD_LIMIT (1 << 20)
+
+Int3 FmodSourceGrid::GetCellCoord(const Vector3& position) const
+{
+    return Int3(
+        static_cast<int32>(Math::Clamp<Real>(Math::Floor(position.X * _invCellSize), -GRID_COORD_LIMIT, GRID_COORD_LIMIT - 1)),
+        static_cast<int32>(Math::Clamp<Real>(Math::Floor(position.Y * _invCellSize), -GRID_COORD_LIMIT, GRID_COORD_LIMIT - 1)),
+        static_cast<int32>(Math::Clamp<Real>(Math::Floor(position.Z * _invCellSize), -GRID_COORD_LIMIT, GRID_COORD_LIMIT - 1)));
+}
+
+uint64 FmodSourceGrid::GetCellKey(const Int3& coord)
+{
+    const uint64 mask = (1ull << 21) - 1;
+    return (static_cast<uint64>(coord.X + GRID_COORD_LIMIT) & mask) << 42 | (static_cast<uint64>(coord.Y + GRID_COORD_LIMIT) & mask) << 21 | (static_cast<uint64>(coord.Z + GRID_COORD_LIMIT) & mask);
+}
+
+void FmodSourceGrid::AddToCell(FmodAudioSource* source, uint64 key)
+{
+    // New cells reuse the storage of removed ones so sources moving between cells don't reallocate.
+    auto& cell = _cells[key];
+    if (cell.Capacity() == 0 && _freeCells.HasItems())
+    {
+        cell.Swap(_freeCells.Last());
+        _freeCells.RemoveLast();
+    }
+    source->_gridCell = key;
+    source->_gridIndex = cell.Count();
+    cell.Add(source);
+}
+
+void FmodSourceGrid::RemoveFromCell(FmodAudioSource* source)
+{
+    auto& cell = _cells[source->_gridCell];
+    const int32 index = source->_gridIndex;
+    const auto last = cell.Last();
+    cell[index] = last;
+    last->_gridIndex = index;
+    cell.RemoveLast();
+    source->_gridIndex = -1;
+
+    // Empty cells are removed so the cell count follows the occupied space.
+    if (cell.IsEmpty())
+    {
+        if (_freeCells.Count() < MaxFreeCells)
+            _freeCells.AddOne().Swap(cell);
+        _cells.Remove(source->_gridCell);
+    }
+}
+
+void FmodSourceGrid::SetCellSize(float cellSize)
+{
+    cellSize = Math::Max(cellSize, 1.0f);
+    if (Math::NearEqual(static_cast<Real>(cellSize), _cellSize))
+        return;
+
+    Array<FmodAudioSource*> sources;
+    sources.EnsureCapacity(_count);
+    for (const auto& cell : _cells)
+        sources.Add(cell.Value.Get(), cell.Value.Count());
+    Clear();
+    _cellSize = cellSize;
+    _invCellSize = 1.0f / _cellSize;
+    for (const auto source : sources)
+        Add(source);
+}
+
+void FmodSourceGrid::Add(FmodAudioSource* source)
+{
+    if (source->_gridIndex != -1)
+        return;
+    AddToCell(source, GetCellKey(GetCellCoord(source->GetPosition())));
+    _count++;
+}
+
+void FmodSourceGrid::Remove(FmodAudioSource* source)
+{
+    if (source->_gridIndex == -1)
+        return;
+    RemoveFromCell(source);
+    _count--;
+}
+
+void FmodSourceGrid::Update(FmodAudioSource* source)
+{
+    if (source->_gridIndex == -1)
+        return;
+    const uint64 key = GetCellKey(GetCellCoord(source->GetPosition()));
+    if (key == source->_gridCell)
+        return;
+    RemoveFromCell(source);
+    AddToCell(source, key);
+}
+
+void FmodSourceGrid::Clear()
+{
+    for (auto& cell : _cells)
+    {
+        for (const auto source : cell.Value)
+            source->_gridIndex = -1;
+    }
+    _cells.Clear();
+    _count = 0;
+}
+
+void FmodSourceGrid::GatherAll(const Vector3& position, Real maxDistanceSquared, Array<Candidate>& candidates) const
+{
+    for (const auto& cell : _cells)
+    {
+        for (const auto source : cell.Value)
+        {
+            const Real distanceSquared = Vector3::DistanceSquared(position, source->GetPosition());
+            if (distanceSquared <= maxDistanceSquared)
+                candidates.Add({ source, distanceSquared });
+        }
+    }
+}
+
+void FmodSourceGrid::GatherCell(const Int3& coord, const Vector3& position, Real maxDistanceSquared, Array<Candidate>& candidates) const
+{
+    const Array<FmodAudioSource*>* cell = _cells.TryGet(GetCellKey(coord));
+    if (!cell)
+        return;
+    for (const auto source : *cell)
+    {
+        const Real distanceSquared = Vector3::DistanceSquared(position, source->GetPosition());
+        if (distanceSquared <= maxDistanceSquared)
+            candidates.Add({ source, distanceSquared });
+    }
+}
+
+void FmodSourceGrid::FindInRadius(const Vector3& center, Real radius, Array<FmodAudioSource*>& result) const
+{
+    result.Clear();
+    if (_count == 0 || radius < 0)
+        return;
+
+    const Int3 min = GetCellCoord(center - radius);
+    const Int3 max = GetCellCoord(center + radius);
+    const Real radiusSquared = radius * radius;
+    Array<Candidate> candidates;
+
+    // Visiting all the sources is cheaper than looking up more cells than exist.
+    const int64 cellCount = static_cast<int64>(max.X - min.X + 1) * (max.Y - min.Y + 1) * (max.Z - min.Z + 1);
+    if (cellCount > _cells.Count())
+    {
+        GatherAll(center, radiusSquared, candidates);
+    }
+    else
+    {
+        for (int32 x = min.X; x <= max.X; x++)
+        {
+            for (int32 y = min.Y; y <= max.Y; y++)
+            {
+                for (int32 z = min.Z; z <= max.Z; z++)
+                    GatherCell(Int3(x, y, z), center, radiusSquared, candidates);
+            }
+        }
+    }
+
+    result.EnsureCapacity(candidates.Count());
+    for (const auto& candidate : candidates)
+        result.Add(candidate.Source);
+}
+
+void FmodSourceGrid::FindNearest(const Vector3& position, int32 count, Real maxDistance, Array<FmodAudioSource*>& result) const
+{
+    result.Clear();
+    if (_count == 0 || count <= 0 || maxDistance < 0)
+        return;
+
+    // Search shells of cells around the position until the nearest ones found are closer than any unvisited cell.
+    const Int3 center = GetCellCoord(position);
+    const Real maxDistanceSquared = maxDistance * maxDistance;
+    const int32 maxRing = static_cast<int32>(Math::Min<Real>(Math::Ceil(maxDistance * _invCellSize), GRID_COORD_LIMIT));
+    Array<Candidate> candidates;
+    for (int32 ring = 0; ring <= maxRing; ring++)
+    {
+        const int64 side = ring * 2 + 1;
+        if (side * side * side > _cells.Count())
+        {
+            candidates.Clear();
+            GatherAll(position, maxDistanceSquared, candidates);
+            break;
+        }
+
+        for (int32 x = -ring; x <= ring; x++)
+        {
+            for (int32 y = -ring; y <= ring; y++)
+            {
+                const bool onShell = Math::Abs(x) == ring || Math::Abs(y) == ring;
+                for (int32 z = -ring; z <= ring; z += onShell ? 1 : ring * 2)
+                    GatherCell(Int3(center.X + x, center.Y + y, center.Z + z), position, maxDistanceSquared, candidates);
+            }
+        }
+
+        // Unvisited cells are at least ring cells away from the position.
+        if (candidates.Count() >= count)
+        {
+            Sorting::QuickSort(candidates.Get(), candidates.Count());
+            const Real searched = ring * _cellSize;
+            if (candidates[count - 1].DistanceSquared <= searched * searched)
+                break;
+        }
+    }
+
+    Sorting::QuickSort(candidates.Get(), candidates.Count());
+    const int32 resultCount = Math::Min(count, candidates.Count());
+    result.EnsureCapacity(resultCount);
+    for (int32 i = 0; i < resultCount; i++)
+        result.Add(candidates[i].Source);
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/BaseTypes.h"
+
+class FmodAudioSource;
+
+/// <summary>
+/// A uniform grid of the enabled audio sources used for proximity queries. Sources are moved between cells as their transform changes.
+/// </summary>
+class FmodSourceGrid
+{
+private:
+    struct Candidate
+    {
+        FmodAudioSource* Source;
+        Real DistanceSquared;
+
+        bool operator<(const Candidate& other) const
+        {
+            return DistanceSquared < other.DistanceSquared;
+        }
+    };
+
+    static constexpr int32 MaxFreeCells = 64;
+
+    Dictionary<uint64, Array<FmodAudioSource*>> _cells;
+    Array<Array<FmodAudioSource*>> _freeCells;
+    Real _cellSize = 5000.0f;
+    Real _invCellSize = 1.0f / 5000.0f;
+    int32 _count = 0;
+
+    Int3 GetCellCoord(const Vector3& position) const;
+    static uint64 GetCellKey(const Int3& coord);
+    void AddToCell(FmodAudioSource* source, uint64 key);
+    void RemoveFromCell(FmodAudioSource* source);
+    void GatherAll(const Vector3& position, Real maxDistanceSquared, Array<Candidate>& candidates) const;
+    void GatherCell(const Int3& coord, const Vector3& position, Real maxDistanceSquared, Array<Candidate>& candidates) const;
+
+public:
+    /// <summary>
+    /// Gets the number of sources in the grid.
+    /// </summary>
+    int32 Count() const
+    {
+        return _count;
+    }
+
+    /// <summary>
+    /// Sets the size of the grid cells in world units. Sources already in the grid are re-inserted.
+    /// </summary>
+    void SetCellSize(float cellSize);
+
+    /// <summary>
+    /// Adds a source to the grid at its current position.
+    /// </summary>
+    void Add(FmodAudioSource* source);
+
+    /// <summary>
+    /// Removes a source from the grid.
+    /// </summary>
+    void Remove(FmodAudioSource* source);
+
+    /// <summary>
+    /// Moves a source to the cell of its current position. Does nothing if the source is not in the grid or stays in the same cell.
+    /// </summary>
+    void Update(FmodAudioSource* source);
+
+    /// <summary>
+    /// Removes all sources from the grid.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Finds the sources within the radius of the center. The result is not sorted.
+    /// </summary>
+    void FindInRadius(const Vector3& center, Real radius, Array<FmodAudioSource*>& result) const;
+
+    /// <summary>
+    /// Finds up to count sources nearest to the position and within the max distance, sorted from the nearest.
+    /// </summary>
+    void FindNearest(const Vector3& position, int32 count, Real maxDistance, Array<FmodAudioSource*>& result) const;
+};
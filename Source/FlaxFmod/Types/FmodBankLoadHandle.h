@@ -0,0 +1,96 @@
+﻿#pragma once
+#include "fmod_studio.hpp"
+#include "Engine/Core/Config.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+/// <summary>
+/// Tracks an asynchronous bank load. The handle is destroyed when the bank is unloaded, or right after Failed fires when the load fails.
+/// </summary>
+API_CLASS(NoSpawn) class FLAXFMOD_API FmodBankLoadHandle : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(FmodBankLoadHandle);
+    friend class FmodAudioSystem;
+
+    enum class States
+    {
+        LoadingMetadata,
+        LoadingSampleData,
+        Loaded,
+        Failed,
+    };
+
+    explicit FmodBankLoadHandle()
+        : ScriptingObject(SpawnParams(Guid::New(), TypeInitializer))
+    {
+    }
+
+private:
+    FMOD::Studio::Bank* _bank = nullptr;
+    bool _loadSampleData = false;
+    States _state = States::LoadingMetadata;
+
+public:
+    /// <summary>
+    /// The bank file path.
+    /// </summary>
+    API_FIELD(ReadOnly) String BankPath;
+
+    /// <summary>
+    /// Fired when the bank and the requested sample data are loaded.
+    /// </summary>
+    API_EVENT() Action Loaded;
+
+    /// <summary>
+    /// Fired when the bank fails to load. Every load request that joined this load is undone, so the bank must not be unloaded.
+    /// The handle is destroyed right after this event, do not keep references to it.
+    /// </summary>
+    API_EVENT() Action Failed;
+
+    /// <summary>
+    /// Gets the load progress from 0 to 1. Metadata and sample data loading each count for half when sample data is requested.
+    /// </summary>
+    API_PROPERTY() float GetProgress() const
+    {
+        switch (_state)
+        {
+        case States::LoadingSampleData:
+            return 0.5f;
+        case States::Loaded:
+        case States::Failed:
+            return 1.0f;
+        default:
+            return 0.0f;
+        }
+    }
+
+    /// <summary>
+    /// Gets whether the load finished, either loaded or failed.
+    /// </summary>
+    API_PROPERTY() bool IsDone() const
+    {
+        return _state == States::Loaded || _state == States::Failed;
+    }
+
+    /// <summary>
+    /// Gets whether the bank is loaded.
+    /// </summary>
+    API_PROPERTY() bool IsLoaded() const
+    {
+        return _state == States::Loaded;
+    }
+
+    /// <summary>
+    /// Gets whether the bank failed to load.
+    /// </summary>
+    API_PROPERTY() bool IsFailed() const
+    {
+        return _state == States::Failed;
+    }
+
+    String ToString() const override
+    {
+        return BankPath;
+    }
+};
@@ -0,0 +1,65 @@
+﻿#pragma once
+#include "fmod_studio.hpp"
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+
+class FmodBankFileData;
+
+/// <summary>
+/// The residency state of a loaded bank. Metadata and sample data are reference counted separately.
+/// </summary>
+struct FmodBankResidency
+{
+    /// <summary>
+    /// The fmod bank.
+    /// </summary>
+    FMOD::Studio::Bank* Bank = nullptr;
+
+    /// <summary>
+    /// The bank file path.
+    /// </summary>
+    String Path;
+
+    /// <summary>
+    /// The memory mapped file data the bank was loaded from. Owned by the residency and kept until fmod finishes unloading the bank.
+    /// </summary>
+    FmodBankFileData* FileData = nullptr;
+
+    /// <summary>
+    /// The number of load requests keeping the bank loaded. The bank is unloaded when this reaches zero.
+    /// </summary>
+    int32 MetadataRefs = 0;
+
+    /// <summary>
+    /// The number of references keeping the sample data loaded, from load requests and explicit sample data loads. Unreferenced sample data can be evicted when over the memory budget.
+    /// </summary>
+    int32 SampleDataRefs = 0;
+
+    /// <summary>
+    /// The number of sample data references taken by load requests. Released by unloads that undo a load with sample data.
+    /// </summary>
+    int32 LoadSampleDataRefs = 0;
+
+    /// <summary>
+    /// Whether a sample data load was requested from fmod and not unloaded yet.
+    /// </summary>
+    bool SampleDataRequested = false;
+
+    /// <summary>
+    /// The estimated memory used by the sample data in bytes. Fmod does not report memory per bank so this is the bank file size.
+    /// </summary>
+    uint64 SampleDataSize = 0;
+
+    /// <summary>
+    /// The time in seconds when the bank was last used to create an event instance.
+    /// </summary>
+    double LastUsedTime = 0.0;
+
+    /// <summary>
+    /// Returns true if the sample data is loaded but no longer referenced.
+    /// </summary>
+    bool IsSampleDataEvictable() const
+    {
+        return SampleDataRequested && SampleDataRefs == 0;
+    }
+};
@@ -0,0 +1,50 @@
+﻿#pragma once
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// A handle to an event instance owned by the audio system. The low 16 bits are the slot index and the high 16 bits the slot generation, so handles to released instances are detected.
+/// </summary>
+struct FmodEventHandle
+{
+    /// <summary>
+    /// The packed index and generation. Zero is an invalid handle.
+    /// </summary>
+    uint32 Value = 0;
+
+    FmodEventHandle() = default;
+
+    FmodEventHandle(uint16 index, uint16 generation)
+        : Value(static_cast<uint32>(index) | static_cast<uint32>(generation) << 16)
+    {
+    }
+
+    uint16 GetIndex() const
+    {
+        return static_cast<uint16>(Value & 0xFFFF);
+    }
+
+    uint16 GetGeneration() const
+    {
+        return static_cast<uint16>(Value >> 16);
+    }
+
+    bool IsValid() const
+    {
+        return Value != 0;
+    }
+
+    explicit operator bool() const
+    {
+        return Value != 0;
+    }
+
+    bool operator==(const FmodEventHandle& other) const
+    {
+        return Value == other.Value;
+    }
+
+    bool operator!=(const FmodEventHandle& other) const
+    {
+        return Value != other.Value;
+    }
+};
@@ -0,0 +1,132 @@
+﻿#pragma once
+#include "fmod_studio.hpp"
+#include "FmodEventHandle.h"
+#include "FmodParameterId.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/String.h"
+
+class FmodAudioSource;
+
+/// <summary>
+/// The event description data cached by the audio system so hot paths don't have to query FMOD.
+/// </summary>
+struct FmodEventMetadata
+{
+    /// <summary>
+    /// The fmod event description.
+    /// </summary>
+    FMOD::Studio::EventDescription* Description = nullptr;
+
+    /// <summary>
+    /// The bank the description was cached from. Null if resolved on demand before its bank was cached.
+    /// </summary>
+    FMOD::Studio::Bank* Bank = nullptr;
+
+    /// <summary>
+    /// The event path. Empty if the strings bank is not loaded.
+    /// </summary>
+    String Path;
+
+    /// <summary>
+    /// The precomputed hash of the event path.
+    /// </summary>
+    uint32 PathHash = 0;
+
+    /// <summary>
+    /// Whether the event is 3D.
+    /// </summary>
+    bool Is3D = false;
+
+    /// <summary>
+    /// Whether the event is a one-shot.
+    /// </summary>
+    bool IsOneshot = false;
+
+    /// <summary>
+    /// The event length in seconds.
+    /// </summary>
+    float Length = -1.0f;
+
+    /// <summary>
+    /// The minimum distance authored in fmod studio.
+    /// </summary>
+    float MinDistance = 0.0f;
+
+    /// <summary>
+    /// The maximum distance authored in fmod studio.
+    /// </summary>
+    float MaxDistance = 0.0f;
+
+    /// <summary>
+    /// The event parameter descriptions. Names are owned by fmod and valid while the bank is loaded.
+    /// </summary>
+    Array<FMOD_STUDIO_PARAMETER_DESCRIPTION> Parameters;
+
+    /// <summary>
+    /// The parameter ids by parameter name.
+    /// </summary>
+    Dictionary<String, FmodParameterId> ParameterIds;
+
+    /// <summary>
+    /// The number of pooled instances kept for reuse. Zero if the event is not pooled.
+    /// </summary>
+    mutable int32 WarmCount = 0;
+
+    /// <summary>
+    /// The stopped instances ready for reuse. Invalidated by fmod together with the bank.
+    /// </summary>
+    mutable Array<FMOD::Studio::EventInstance*> Pool;
+};
+
+/// <summary>
+/// The per event instance data stored densely by the audio system.
+/// </summary>
+struct FmodEventInstanceData
+{
+    /// <summary>
+    /// The fmod event instance.
+    /// </summary>
+    FMOD::Studio::EventInstance* Instance = nullptr;
+
+    /// <summary>
+    /// The handle of the instance.
+    /// </summary>
+    FmodEventHandle Handle;
+
+    /// <summary>
+    /// The source that owns the instance.
+    /// </summary>
+    FmodAudioSource* Source = nullptr;
+
+    /// <summary>
+    /// The description metadata of the instance.
+    /// </summary>
+    const FmodEventMetadata* Metadata = nullptr;
+
+    /// <summary>
+    /// The current minimum distance, including any override.
+    /// </summary>
+    float MinDistance = 0.0f;
+
+    /// <summary>
+    /// The current maximum distance, including any override.
+    /// </summary>
+    float MaxDistance = 0.0f;
+
+    /// <summary>
+    /// Whether the instance counts toward the instance limit of its event. Cleared once it stops.
+    /// </summary>
+    bool Limited = false;
+
+    /// <summary>
+    /// Whether the instance has no source and goes back to the event pool once it stops.
+    /// </summary>
+    bool Pooled = false;
+
+    /// <summary>
+    /// The position a one-shot without a source was played at.
+    /// </summary>
+    Vector3 Position = Vector3::Zero;
+};
@@ -0,0 +1,307 @@
+﻿#pragma once
+#include "Engine/Core/Config.h"
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Platform/Defines.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The fmod studio system init flags. Values match FMOD_STUDIO_INITFLAGS.
+/// </summary>
+API_ENUM(Attributes="Flags") enum class FmodStudioInitFlags : uint32
+{
+    /// <summary>
+    /// No flags.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// Enables live update so fmod studio can connect to the game.
+    /// </summary>
+    LiveUpdate = 0x00000001,
+
+    /// <summary>
+    /// Loads banks even if they reference plugins that are not loaded.
+    /// </summary>
+    AllowMissingPlugins = 0x00000002,
+
+    /// <summary>
+    /// Runs the studio processing on the thread calling update instead of the studio command thread.
+    /// </summary>
+    SynchronousUpdate = 0x00000004,
+
+    /// <summary>
+    /// Defers the event callbacks to the update call.
+    /// </summary>
+    DeferredCallbacks = 0x00000008,
+
+    /// <summary>
+    /// Loads banks and sample data on the thread calling update instead of the bank loading thread.
+    /// </summary>
+    LoadFromUpdate = 0x00000010,
+
+    /// <summary>
+    /// Enables detailed memory usage statistics.
+    /// </summary>
+    MemoryTracking = 0x00000020,
+};
+
+DECLARE_ENUM_OPERATORS(FmodStudioInitFlags);
+
+/// <summary>
+/// The fmod core system init flags. Values match FMOD_INITFLAGS.
+/// </summary>
+API_ENUM(Attributes="Flags") enum class FmodCoreInitFlags : uint32
+{
+    /// <summary>
+    /// No flags.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// Uses a right handed coordinate system for 3D.
+    /// </summary>
+    RightHanded3D = 0x00000004,
+
+    /// <summary>
+    /// Clips the output to the -1 to 1 range.
+    /// </summary>
+    ClipOutput = 0x00000008,
+
+    /// <summary>
+    /// Enables the channel lowpass filter used by occlusion.
+    /// </summary>
+    ChannelLowpass = 0x00000100,
+
+    /// <summary>
+    /// Enables the distance based lowpass filter on all 3D channels.
+    /// </summary>
+    ChannelDistanceFilter = 0x00000200,
+
+    /// <summary>
+    /// Enables the profiler connection.
+    /// </summary>
+    ProfileEnable = 0x00010000,
+
+    /// <summary>
+    /// Makes channels with zero volume virtual so they use no mixing time.
+    /// </summary>
+    Vol0BecomesVirtual = 0x00020000,
+
+    /// <summary>
+    /// Disables the internal thread safety. Only use when every fmod call is made from a single thread.
+    /// </summary>
+    ThreadUnsafe = 0x00100000,
+
+    /// <summary>
+    /// Enables detailed memory usage statistics.
+    /// </summary>
+    MemoryTracking = 0x00400000,
+};
+
+DECLARE_ENUM_OPERATORS(FmodCoreInitFlags);
+
+/// <summary>
+/// The output speaker mode. Values match FMOD_SPEAKERMODE.
+/// </summary>
+API_ENUM() enum class FmodSpeakerMode
+{
+    /// <summary>
+    /// The speaker mode of the output device.
+    /// </summary>
+    Default,
+
+    /// <summary>
+    /// Channels are passed through without panning.
+    /// </summary>
+    Raw,
+
+    /// <summary>
+    /// One speaker.
+    /// </summary>
+    Mono,
+
+    /// <summary>
+    /// Two speakers.
+    /// </summary>
+    Stereo,
+
+    /// <summary>
+    /// Four speakers.
+    /// </summary>
+    Quad,
+
+    /// <summary>
+    /// Five speakers.
+    /// </summary>
+    Surround,
+
+    /// <summary>
+    /// Five speakers and a subwoofer.
+    /// </summary>
+    FivePointOne,
+
+    /// <summary>
+    /// Seven speakers and a subwoofer.
+    /// </summary>
+    SevenPointOne,
+
+    /// <summary>
+    /// Seven speakers, a subwoofer and four height speakers.
+    /// </summary>
+    SevenPointOnePointFour,
+};
+
+/// <summary>
+/// The fmod output type.
+/// </summary>
+API_ENUM() enum class FmodOutputType
+{
+    /// <summary>
+    /// The platform default output device.
+    /// </summary>
+    Auto,
+
+    /// <summary>
+    /// No output. Mixes in real time.
+    /// </summary>
+    NoSound,
+
+    /// <summary>
+    /// No output. Mixes only when the system is updated, so runs without an audio device at any speed. Used for benchmarks.
+    /// </summary>
+    NoSoundNrt,
+
+    /// <summary>
+    /// Writes the mix to a wav file, mixing only when the system is updated. The audio system is not updated by the scripts and is stepped by FmodCapture instead. Used for offline renders.
+    /// </summary>
+    WavWriterNrt,
+};
+
+/// <summary>
+/// The build configurations an init settings override applies to.
+/// </summary>
+API_ENUM() enum class FmodBuildConfiguration
+{
+    /// <summary>
+    /// All build configurations.
+    /// </summary>
+    Any,
+
+    /// <summary>
+    /// Debug builds.
+    /// </summary>
+    Debug,
+
+    /// <summary>
+    /// Development builds.
+    /// </summary>
+    Development,
+
+    /// <summary>
+    /// Release builds.
+    /// </summary>
+    Release,
+};
+
+/// <summary>
+/// The settings used to initialize the fmod system.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodInitSettings : public ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodInitSettings);
+public:
+
+    /// <summary>
+    /// The fmod studio system init flags.
+    /// </summary>
+    API_FIELD() FmodStudioInitFlags StudioFlags = FmodStudioInitFlags::None;
+
+    /// <summary>
+    /// The output type. Set before the system is initialized.
+    /// </summary>
+    API_FIELD() FmodOutputType OutputType = FmodOutputType::Auto;
+
+    /// <summary>
+    /// The fmod core system init flags.
+    /// </summary>
+    API_FIELD() FmodCoreInitFlags CoreFlags = FmodCoreInitFlags::None;
+
+    /// <summary>
+    /// The max number of channels that are mixed at once. Channels above it are virtual.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0, 4095)") int32 SoftwareChannels = 64;
+
+    /// <summary>
+    /// The output sample rate in Hz. Zero uses the device default.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0, 384000)") int32 SampleRate = 0;
+
+    /// <summary>
+    /// The output speaker mode.
+    /// </summary>
+    API_FIELD() FmodSpeakerMode SpeakerMode = FmodSpeakerMode::Default;
+
+    /// <summary>
+    /// The length of a DSP buffer in samples. Lower values reduce latency but use more CPU. Zero uses the platform default.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") int32 DspBufferLength = 0;
+
+    /// <summary>
+    /// The number of DSP buffers in the output ring. Zero uses the platform default.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") int32 DspBufferCount = 0;
+
+    /// <summary>
+    /// The scale of the doppler effect on all 3D sounds.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") float DopplerScale = 1.0f;
+
+    /// <summary>
+    /// The fmod 3D distance factor. Scales the doppler effect to the world units.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0.0001f)") float DistanceFactor = 0.01f;
+
+    /// <summary>
+    /// The scale of the distance attenuation of all 3D sounds.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0)") float RolloffScale = 1.0f;
+
+    /// <summary>
+    /// The wav file written by the WavWriterNrt output type, relative to the project folder. Empty uses fmod's default file name.
+    /// </summary>
+    API_FIELD() String WavWriterPath;
+
+    /// <summary>
+    /// The seed of fmod's random number generators. Set it to make event randomization repeat between runs. Zero keeps fmod's default.
+    /// </summary>
+    API_FIELD() uint32 RandomSeed = 0;
+};
+
+/// <summary>
+/// The init settings used on some platforms and build configurations.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodInitSettingsOverride : public ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodInitSettingsOverride);
+public:
+
+    /// <summary>
+    /// The platforms the override applies to. Empty applies to all platforms.
+    /// </summary>
+    API_FIELD() Array<PlatformType> Platforms;
+
+    /// <summary>
+    /// The build configuration the override applies to.
+    /// </summary>
+    API_FIELD() FmodBuildConfiguration Configuration = FmodBuildConfiguration::Any;
+
+    /// <summary>
+    /// The init settings to use.
+    /// </summary>
+    API_FIELD() FmodInitSettings Settings;
+};
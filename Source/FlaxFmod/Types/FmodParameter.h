@@ -3,6 +3,7 @@
 #include "Engine/Core/ISerializable.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Scripting/ScriptingType.h"
+#include "FmodParameterId.h"
 
 API_STRUCT() struct FLAXFMOD_API FmodParameter: public ISerializable
 {
@@ -12,4 +13,9 @@ public:
     
     API_FIELD() String Name;
     API_FIELD() float Value;
+
+    /// <summary>
+    /// The resolved parameter id. Resolved from the name the first time the parameter is applied.
+    /// </summary>
+    FmodParameterId Id;
 };
@@ -0,0 +1,47 @@
+﻿#pragma once
+#include "fmod_studio_common.h"
+#include "Engine/Core/Config.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// A resolved fmod parameter handle. Setting parameters by id skips the by-name lookup.
+/// </summary>
+API_STRUCT() struct FLAXFMOD_API FmodParameterId
+{
+    DECLARE_SCRIPTING_TYPE_STRUCTURE(FmodParameterId);
+public:
+
+    /// <summary>
+    /// The first part of the fmod parameter id.
+    /// </summary>
+    API_FIELD() uint32 Data1 = 0;
+
+    /// <summary>
+    /// The second part of the fmod parameter id.
+    /// </summary>
+    API_FIELD() uint32 Data2 = 0;
+
+    FmodParameterId() = default;
+
+    explicit FmodParameterId(const FMOD_STUDIO_PARAMETER_ID& id)
+        : Data1(id.data1)
+        , Data2(id.data2)
+    {
+    }
+
+    /// <summary>
+    /// Returns true if the id was resolved.
+    /// </summary>
+    bool IsValid() const
+    {
+        return Data1 != 0 || Data2 != 0;
+    }
+
+    FMOD_STUDIO_PARAMETER_ID ToFmod() const
+    {
+        return { Data1, Data2 };
+    }
+};
+
+// Arrays of ids are passed to fmod as-is in batched parameter calls.
+static_assert(sizeof(FmodParameterId) == sizeof(FMOD_STUDIO_PARAMETER_ID), "FmodParameterId must match FMOD_STUDIO_PARAMETER_ID layout.");
@@ -25,8 +25,10 @@ public sealed class FmodAudioListenerNode : ActorNodeWithIcon
         base.OnDebugDraw(data);
         if (Engine.IsPlayMode)
         {
-            // Draw all sources when listener is selected.
-            var sources = FmodAudio.Sources;
+            // Draw the sources near the listener when it is selected, or all of them without a radius.
+            var settings = Engine.GetCustomSettings("FmodAudioSettings")?.GetInstance<FmodAudioSettings>();
+            var radius = settings?.ListenerDebugDrawRadius ?? 0.0f;
+            var sources = radius > 0.0f ? FmodAudio.FindSourcesInRadius(Actor.Position, radius) : FmodAudio.Sources;
             foreach (var source in sources)
             {
                 if (!source.OverrideDistance || !source.Is3D())